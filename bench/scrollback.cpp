@@ -0,0 +1,103 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Fills the scrollback with build log lines through libvterm's sb_pushline, the way
+// VTermToFBInk does, then measures searches that walk back through all of it.
+//
+//   make bench && ./build/bench_scrollback.host [lines]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <string>
+
+#include "../libvterm/include/vterm.h"
+#include "../src/scrollback.hpp"
+#include "../src/search.hpp"
+
+static double now() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) / 1e9;
+}
+
+static Scrollback scrollback;
+static SearchIndex search;
+
+static int sb_pushline(int cols, const VTermScreenCell * cells, void * user __attribute__((unused))) {
+    uint64_t line = scrollback.total();
+    scrollback.push(cols, cells);
+    search.push(line, search_fold(scrollback.text(scrollback.size() - 1u)));
+    search.drop_before(scrollback.total() - scrollback.size());
+    return 1;
+}
+
+// All matches, newest first, as VTermToFBInk::find_line() walks them
+static size_t find_all(const std::string & query, double & seconds) {
+    std::string needle = search_fold(query);
+    uint64_t first = scrollback.total() - scrollback.size();
+    auto text_of = [first](uint64_t line) { return search_fold(scrollback.text(static_cast<size_t>(line - first))); };
+    size_t n = 0u;
+    double start = now();
+    for (uint64_t line = scrollback.total(); (line = search.find_older(needle, first, line, text_of)) != UINT64_MAX;) {
+        n++;
+    }
+    seconds = now() - start;
+    return n;
+}
+
+int main(int argc, char ** argv) {
+    long nlines = argc > 1 ? atol(argv[1]) : 100000;
+    scrollback.max_bytes = 1024u * 1024u * 1024u;
+    VTerm * term = vterm_new(50, 100);
+    vterm_set_utf8(term, 1);
+    VTermScreen * screen = vterm_obtain_screen(term);
+    VTermScreenCallbacks callbacks = {};
+    callbacks.sb_pushline = sb_pushline;
+    vterm_screen_set_callbacks(screen, &callbacks, nullptr);
+    vterm_screen_reset(screen, 1);
+
+    char buf[256];
+    double start = now();
+    for (long i = 0; i < nlines; i++) {
+        int len;
+        if (i % 997 == 0) {
+            len = snprintf(buf, sizeof(buf), "\x1b[1;31merror:\x1b[0m src/file%ld.c:%ld: 'x%ld' undeclared\r\n", i % 97, i, i);
+        } else if (i % 16 == 0) {
+            len = snprintf(buf, sizeof(buf), "\x1b[1;35mwarning:\x1b[0m src/file%ld.c:%ld: unused variable 'x%ld'\r\n", i % 97, i, i);
+        } else {
+            len = snprintf(buf, sizeof(buf), "  CC      src/module%ld/file%ld.o\r\n", i % 31, i);
+        }
+        vterm_input_write(term, buf, static_cast<size_t>(len));
+    }
+    double t = now() - start;
+    printf("%zu lines, vterm_input_write and push %.2f us/line, scrollback %.1f bytes/line, index %.1f bytes/line\n",
+            scrollback.size(), t * 1e6 / static_cast<double>(nlines),
+            static_cast<double>(scrollback.bytes()) / static_cast<double>(scrollback.size()),
+            static_cast<double>(search.bytes()) / static_cast<double>(scrollback.size()));
+
+    const char * queries[] = { "undeclared", "file5.c:", "x99999'", "no such thing", "CC", "src/module7/" };
+    for (const char * query : queries) {
+        double seconds;
+        size_t n = find_all(query, seconds);
+        printf("%-16s %6zu matches in %8.2f ms\n", query, n, seconds * 1e3);
+    }
+    vterm_free(term);
+    return 0;
+}
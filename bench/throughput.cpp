@@ -0,0 +1,161 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Measures pty output -> libvterm screen model throughput, comparing the old
+// byte-at-a-time deque path with the RingBuffer span path used by main(),
+// with per-cell damage and with the VTERM_DAMAGE_SCROLL merging VTermToFBInk uses.
+// No framebuffer involved: the callbacks only count cells.
+//
+//   make bench && ./build/bench_throughput.host [megabytes]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <deque>
+#include <string>
+
+#include "../libvterm/include/vterm.h"
+#include "../src/buffers.hpp"
+
+static long ncells_damaged = 0;
+static long ncells_moved = 0;
+
+static int count_damage(VTermRect rect, void * user __attribute__((unused))) {
+    ncells_damaged += (rect.end_row - rect.start_row) * (rect.end_col - rect.start_col);
+    return 1;
+}
+
+static int count_moverect(VTermRect dst, VTermRect src __attribute__((unused)), void * user __attribute__((unused))) {
+    ncells_moved += (dst.end_row - dst.start_row) * (dst.end_col - dst.start_col);
+    return 0;
+}
+
+static double now() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) / 1e9;
+}
+
+// Something that looks like a build log or dmesg, with the occasional SGR
+static std::string make_log(size_t nbytes) {
+    std::string out;
+    out.reserve(nbytes + 256);
+    unsigned long line = 0;
+    char buf[256];
+    while (out.size() < nbytes) {
+        int n;
+        if (line % 16 == 0) {
+            n = snprintf(buf, sizeof(buf), "\033[1;31mwarning:\033[0m src/file%lu.c:%lu: unused variable 'x%lu'\r\n", line % 97, line, line);
+        } else {
+            n = snprintf(buf, sizeof(buf), "[%8lu.%06lu] usb 1-1: new high-speed USB device number %lu using ci_hdrc\r\n", line / 1000, line % 1000000, line % 128);
+        }
+        out.append(buf, static_cast<size_t>(n));
+        line++;
+    }
+    return out;
+}
+
+struct Term {
+    VTerm * term;
+    VTermScreen * screen;
+    VTermScreenCallbacks cbs = {};
+
+    explicit Term(VTermDamageSize merge = VTERM_DAMAGE_CELL) {
+        ncells_damaged = 0;
+        ncells_moved = 0;
+        term = vterm_new(50, 100);
+        vterm_set_utf8(term, 1);
+        screen = vterm_obtain_screen(term);
+        cbs.damage = count_damage;
+        cbs.moverect = count_moverect;
+        vterm_screen_set_callbacks(screen, &cbs, nullptr);
+        vterm_screen_set_damage_merge(screen, merge);
+        vterm_screen_enable_altscreen(screen, 1);
+        vterm_screen_reset(screen, 1);
+    }
+
+    ~Term() {
+        vterm_free(term);
+    }
+};
+
+// Old path: 64 byte reads pushed into a deque, popped one byte per vterm_input_write()
+static double run_deque(const std::string & log) {
+    Term t;
+    std::deque<char> vt100_in;
+    double start = now();
+    size_t pos = 0;
+    while (pos < log.size()) {
+        size_t n = std::min<size_t>(64, log.size() - pos);
+        for (size_t i = 0; i < n; i++) {
+            vt100_in.push_back(log[pos + i]);
+        }
+        pos += n;
+        while (vt100_in.size() > 0) {
+            char c = vt100_in.front();
+            vt100_in.pop_front();
+            vterm_input_write(t.term, &c, 1);
+        }
+    }
+    return now() - start;
+}
+
+// New path: read()-sized copies into the ring, whole spans to vterm_input_write(),
+// and the damage flushed once per batch
+static double run_ring(const std::string & log, size_t read_size, VTermDamageSize merge) {
+    Term t(merge);
+    RingBuffer vt100_in(VT100_IN_CAPACITY);
+    double start = now();
+    size_t pos = 0;
+    while (pos < log.size()) {
+        RingBuffer::Span span = vt100_in.write_span();
+        size_t n = std::min(std::min(span.size, read_size), log.size() - pos);
+        memcpy(span.data, log.data() + pos, n);
+        vt100_in.commit(n);
+        pos += n;
+        while (!vt100_in.empty()) {
+            RingBuffer::Span r = vt100_in.read_span();
+            vterm_input_write(t.term, r.data, r.size);
+            vt100_in.consume(r.size);
+        }
+        vterm_screen_flush_damage(t.screen);
+    }
+    return now() - start;
+}
+
+int main(int argc, char ** argv) {
+    size_t megabytes = argc > 1 ? strtoul(argv[1], nullptr, 10) : 16;
+    std::string log = make_log(megabytes * 1024 * 1024);
+    double mb = static_cast<double>(log.size()) / (1024.0 * 1024.0);
+
+    printf("%.1f MB\n", mb);
+    double t_deque = run_deque(log);
+    printf("deque, 1 byte/write           %8.2f MB/s, %ld cells damaged, %ld moved\n", mb / t_deque, ncells_damaged, ncells_moved);
+    size_t read_sizes[] = { 4096, VT100_IN_CAPACITY };
+    VTermDamageSize merges[] = { VTERM_DAMAGE_CELL, VTERM_DAMAGE_SCROLL };
+    for (VTermDamageSize merge : merges) {
+        for (size_t read_size : read_sizes) {
+            double t_ring = run_ring(log, read_size, merge);
+            printf("ring, %6zu byte reads, %-6s %8.2f MB/s (%.2fx), %ld cells damaged, %ld moved\n",
+                    read_size, merge == VTERM_DAMAGE_CELL ? "cell" : "scroll",
+                    mb / t_ring, t_deque / t_ring, ncells_damaged, ncells_moved);
+        }
+    }
+    return 0;
+}
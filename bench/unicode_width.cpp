@@ -0,0 +1,152 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Measures libvterm's character width lookups, on their own and as part of
+// vterm_input_write(), for ASCII, CJK and emoji heavy text.
+//
+//   make bench && ./build/bench_unicode_width.host [megabytes]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../libvterm/include/vterm.h"
+
+// Internal to libvterm, but a static link still finds them
+extern "C" int vterm_unicode_width(uint32_t codepoint);
+extern "C" int vterm_unicode_is_combining(uint32_t codepoint);
+
+static double now() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) / 1e9;
+}
+
+static void put_utf8(std::string & out, uint32_t cp) {
+    if (cp < 0x80u) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800u) {
+        out.push_back(static_cast<char>(0xC0u | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80u | (cp & 0x3Fu)));
+    } else if (cp < 0x10000u) {
+        out.push_back(static_cast<char>(0xE0u | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu)));
+        out.push_back(static_cast<char>(0x80u | (cp & 0x3Fu)));
+    } else {
+        out.push_back(static_cast<char>(0xF0u | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80u | ((cp >> 12) & 0x3Fu)));
+        out.push_back(static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu)));
+        out.push_back(static_cast<char>(0x80u | (cp & 0x3Fu)));
+    }
+}
+
+struct Stream {
+    const char * name;
+    std::vector<uint32_t> codepoints;
+    std::string utf8;
+};
+
+// Lines of 60 codepoints, picked by next() from a small xorshift generator
+template <typename F>
+static Stream make_stream(const char * name, size_t nbytes, F next) {
+    Stream s = { name, {}, {} };
+    uint32_t x = 2463534242u;
+    while (s.utf8.size() < nbytes) {
+        for (int i = 0; i < 60; i++) {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            uint32_t cp = next(x);
+            s.codepoints.push_back(cp);
+            put_utf8(s.utf8, cp);
+        }
+        s.codepoints.push_back('\r');
+        s.codepoints.push_back('\n');
+        s.utf8 += "\r\n";
+    }
+    return s;
+}
+
+static std::vector<Stream> make_streams(size_t nbytes) {
+    std::vector<Stream> streams;
+    streams.push_back(make_stream("ascii", nbytes, [](uint32_t x) {
+        return 0x20u + x % 95u;
+    }));
+    // CJK ideographs, kana and hangul, with some ASCII and CJK punctuation in between
+    streams.push_back(make_stream("cjk", nbytes, [](uint32_t x) {
+        switch (x % 8u) {
+            case 0: return 0x20u + (x >> 3) % 95u;
+            case 1: return 0x3000u + (x >> 3) % 0x40u;
+            case 2: return 0x3041u + (x >> 3) % 0x56u;
+            case 3: return 0xAC00u + (x >> 3) % 0x2BA4u;
+            default: return 0x4E00u + (x >> 3) % 0x5200u;
+        }
+    }));
+    // Pictographs with variation selectors, skin tones and ZWJs, which go through the combining check
+    streams.push_back(make_stream("emoji", nbytes, [](uint32_t x) {
+        switch (x % 8u) {
+            case 0: return 0x20u;
+            case 1: return 0xFE0Fu;
+            case 2: return 0x1F3FBu + (x >> 3) % 5u;
+            case 3: return 0x200Du;
+            case 4: return 0x2600u + (x >> 3) % 0x100u;
+            default: return 0x1F300u + (x >> 3) % 0x300u;
+        }
+    }));
+    return streams;
+}
+
+static double run_lookups(const Stream & s, long & checksum) {
+    double start = now();
+    for (uint32_t cp : s.codepoints) {
+        checksum += vterm_unicode_width(cp) + vterm_unicode_is_combining(cp);
+    }
+    return now() - start;
+}
+
+static double run_write(const Stream & s) {
+    VTerm * term = vterm_new(50, 100);
+    vterm_set_utf8(term, 1);
+    VTermScreen * screen = vterm_obtain_screen(term);
+    vterm_screen_reset(screen, 1);
+    double start = now();
+    for (size_t pos = 0u; pos < s.utf8.size(); pos += 4096u) {
+        vterm_input_write(term, s.utf8.data() + pos, std::min<size_t>(4096u, s.utf8.size() - pos));
+    }
+    double t = now() - start;
+    vterm_free(term);
+    return t;
+}
+
+int main(int argc, char ** argv) {
+    size_t megabytes = argc > 1 ? strtoul(argv[1], nullptr, 10) : 8;
+    long checksum = 0;
+    for (const Stream & s : make_streams(megabytes * 1024 * 1024)) {
+        double mb = static_cast<double>(s.utf8.size()) / (1024.0 * 1024.0);
+        double t_lookup = run_lookups(s, checksum);
+        double t_write = run_write(s);
+        printf("%-6s lookups %6.2f ns/codepoint, vterm_input_write %8.2f MB/s\n",
+                s.name, t_lookup * 1e9 / static_cast<double>(s.codepoints.size()), mb / t_write);
+    }
+    printf("checksum %ld\n", checksum);
+    return 0;
+}
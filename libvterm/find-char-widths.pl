@@ -0,0 +1,87 @@
+#!/usr/bin/perl
+
+# Generates src/charwidth.inc: the cell width and combining flag of every
+# codepoint, from the Unicode database of the perl running this, as a
+# two-level table: a block number per 128 codepoints, and the deduplicated
+# blocks of one byte per codepoint.
+#
+# The rules are those of Markus Kuhn's wcwidth.c (see unicode.c):
+#   - U+0000 has width 0, other C0/C1 controls and DEL have width -1
+#   - Mn, Me and Cf characters (except U+00AD), U+1160..U+11FF and U+200B
+#     are combining
+#   - East Asian Wide and Fullwidth characters have width 2, even when
+#     combining (e.g. U+302A..U+302F)
+#   - combining characters have width 0, everything else width 1
+
+use strict;
+use warnings;
+no warnings 'utf8';
+
+use Unicode::UCD;
+
+my $BLOCK_BITS = 7;
+my $BLOCK_SIZE = 1 << $BLOCK_BITS;
+my $MAX_CP = 0x10FFFF;
+
+sub iswide
+{
+   my ( $cp ) = @_;
+   return chr($cp) =~ m/\p{East_Asian_Width=Wide}|\p{East_Asian_Width=Fullwidth}/;
+}
+
+sub iscombining
+{
+   my ( $cp ) = @_;
+   return 0 if $cp == 0xAD;
+   return 1 if $cp >= 0x1160 and $cp <= 0x11FF;
+   return 1 if $cp == 0x200B;
+   return chr($cp) =~ m/\p{Mn}|\p{Me}|\p{Cf}/;
+}
+
+# bits 0-1: width + 1, bit 2: combining
+sub class
+{
+   my ( $cp ) = @_;
+   return 1 if $cp == 0;
+   return 0 if $cp < 0x20 or ( $cp >= 0x7F and $cp < 0xA0 );
+
+   my $combining = iscombining($cp) ? 4 : 0;
+   return $combining | 3 if iswide($cp);
+   return $combining | ( $combining ? 1 : 2 );
+}
+
+my @index;
+my @blocks;
+my %block_nr;
+for( my $base = 0; $base <= $MAX_CP; $base += $BLOCK_SIZE ) {
+   my $block = join ",", map { class($base + $_) } 0 .. $BLOCK_SIZE-1;
+   if( !exists $block_nr{$block} ) {
+      $block_nr{$block} = scalar @blocks;
+      push @blocks, $block;
+   }
+   push @index, $block_nr{$block};
+}
+
+die "Too many distinct blocks for a uint8_t index\n" if @blocks > 256;
+
+printf "// Generated by find-char-widths.pl from Unicode %s, do not edit\n", Unicode::UCD::UnicodeVersion();
+printf "#define CHARWIDTH_BLOCK_BITS %d\n", $BLOCK_BITS;
+printf "#define CHARWIDTH_MAX 0x%X\n\n", $MAX_CP;
+
+print "static const uint8_t charwidth_index[] = {\n";
+for( my $i = 0; $i < @index; $i += 16 ) {
+   my $end = $i + 15 < $#index ? $i + 15 : $#index;
+   print "  ", join( ", ", @index[$i .. $end] ), ",\n";
+}
+print "};\n\n";
+
+printf "static const uint8_t charwidth_blocks[][%d] = {\n", $BLOCK_SIZE;
+foreach my $block ( @blocks ) {
+   my @values = split m/,/, $block;
+   print "  {\n";
+   for( my $i = 0; $i < @values; $i += 32 ) {
+      print "    ", join( ",", @values[$i .. $i+31] ), ",\n";
+   }
+   print "  },\n";
+}
+print "};\n";
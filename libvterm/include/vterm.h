@@ -435,6 +435,10 @@ typedef struct {
   int (*resize)(int rows, int cols, VTermStateFields *fields, void *user);
   int (*setlineinfo)(int row, const VTermLineInfo *newinfo, const VTermLineInfo *oldinfo, void *user);
   int (*sb_clear)(void *user);
+  /* Optional: len bytes of printable ASCII, one cell each, that all fit in
+   * the row from pos on. info->chars is NULL. Return 0 to get putglyph()
+   * calls instead */
+  int (*putascii)(const char bytes[], int len, VTermGlyphInfo *info, VTermPos pos, void *user);
 } VTermStateCallbacks;
 
 typedef struct {
@@ -220,6 +220,18 @@ encodings[] = {
   { 0 },
 };
 
+INTERNAL int vterm_encoding_passes_ascii(const VTermEncodingInstance *inst)
+{
+  if(inst->enc == &encoding_usascii)
+    return 1;
+
+  /* Unless a multibyte sequence is still pending */
+  if(inst->enc == &encoding_utf8)
+    return !((const struct UTF8DecoderData *)inst->data)->bytes_remaining;
+
+  return 0;
+}
+
 /* This ought to be INTERNAL but isn't because it's used by unit testing */
 VTermEncoding *vterm_lookup_encoding(VTermEncodingType type, char designation)
 {
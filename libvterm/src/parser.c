@@ -3,8 +3,53 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+# include <arm_neon.h>
+#endif
+
 #undef DEBUG_PARSER
 
+/* Length of the run of printable ASCII (0x20 to 0x7e) at the start of bytes,
+ * 16 bytes at a time where the target has SIMD */
+INTERNAL size_t vterm_scan_printable(const char *bytes, size_t len)
+{
+  size_t pos = 0;
+
+#if defined(__SSE2__)
+  /* Signed compare: bytes >= 0x80 are negative */
+  const __m128i space = _mm_set1_epi8(0x1f);
+  const __m128i del   = _mm_set1_epi8(0x7f);
+  for( ; pos + 16 <= len; pos += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(bytes + pos));
+    __m128i ok = _mm_andnot_si128(_mm_cmpeq_epi8(v, del), _mm_cmpgt_epi8(v, space));
+    unsigned int mask = (unsigned int)_mm_movemask_epi8(ok);
+    if(mask != 0xffff)
+      return pos + __builtin_ctz(~mask);
+  }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+  const uint8x16_t space = vdupq_n_u8(0x20);
+  const uint8x16_t del   = vdupq_n_u8(0x7f);
+  for( ; pos + 16 <= len; pos += 16) {
+    uint8x16_t v = vld1q_u8((const uint8_t *)(bytes + pos));
+    uint8x16_t ok = vandq_u8(vcgeq_u8(v, space), vcltq_u8(v, del));
+    /* Narrow to 4 bits per byte, there is no movemask */
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(ok), 4)), 0);
+    if(mask != ~(uint64_t)0)
+      return pos + __builtin_ctzll(~mask) / 4;
+  }
+#endif
+
+  for( ; pos < len; pos++) {
+    unsigned char c = bytes[pos];
+    if(c < 0x20 || c >= 0x7f)
+      break;
+  }
+
+  return pos;
+}
+
 static bool is_intermed(unsigned char c)
 {
   return c >= 0x20 && c <= 0x2f;
@@ -137,6 +182,13 @@ size_t vterm_input_write(VTerm *vt, const char *bytes, size_t len)
 #define IS_STRING_STATE()      (vt->parser.state >= OSC_COMMAND)
 
   for( ; pos < len; pos++) {
+    /* The body of a string only needs looking at for its terminator */
+    if(vt->parser.state >= OSC && !vt->parser.in_esc) {
+      pos += vterm_scan_printable(bytes + pos, len - pos);
+      if(pos == len)
+        break;
+    }
+
     unsigned char c = bytes[pos];
     bool c1_allowed = !vt->mode.utf8;
 
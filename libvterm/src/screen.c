@@ -34,12 +34,45 @@ typedef struct
   unsigned int dhl            : 2; /* on a DECDHL line (1=top 2=bottom) */
 } ScreenPen;
 
+#ifdef VTERM_COMPACT_CELLS
+/* Cells refer to their pen by index into the screen's table of distinct
+ * pens, and hold one codepoint inline. Combining sequences live in the
+ * screen's overflow table instead. Both tables are garbage collected when
+ * they fill up. */
+typedef uint16_t PenRef;
+
+#define CELL_MAX_PENS     65536
+#define CELL_OVERFLOW     0x80000000
+#define CELL_MAX_OVERFLOW 0x7fffffff
+/* Tables grow until they have an entry per CELL_GC_RATIO cells, and are
+ * garbage collected from then on. This keeps the collections, which scan
+ * every cell, rare compared to the entries added */
+#define CELL_GC_RATIO     16
+
+/* Internal representation of a screen cell */
+typedef struct
+{
+  /* 0 when erased, (uint32_t)-1 behind a double-width char, a codepoint,
+   * or CELL_OVERFLOW | index into the overflow table */
+  uint32_t ch;
+  PenRef   pen;
+} ScreenCell;
+
+/* Canonical form of a pen, to compare and hash them */
+typedef struct
+{
+  uint32_t fg, bg, attrs;
+} PenKey;
+#else
+typedef ScreenPen PenRef;
+
 /* Internal representation of a screen cell */
 typedef struct
 {
   uint32_t chars[VTERM_MAX_CHARS_PER_CELL];
-  ScreenPen pen;
+  PenRef pen;
 } ScreenCell;
+#endif
 
 struct VTermScreen
 {
@@ -71,12 +104,321 @@ struct VTermScreen
   VTermScreenCell *sb_buffer;
 
   ScreenPen pen;
+
+#ifdef VTERM_COMPACT_CELLS
+  /* Distinct pens in use, with their keys and an open addressing hash of
+   * index+1 into them */
+  ScreenPen *pens;
+  PenKey *pen_keys;
+  uint32_t *pen_hash;
+  int npens, pens_size;
+  /* The pen looked up last, most lookups are for the same one again */
+  int last_pen;
+
+  /* Combining sequences, each terminated by 0 unless it is full length */
+  uint32_t (*overflow)[VTERM_MAX_CHARS_PER_CELL];
+  int noverflow, overflow_size;
+
+  /* Cells are being copied between buffers that aren't in buffers[] */
+  unsigned int resizing : 1;
+#endif
 };
 
-static inline void clearcell(const VTermScreen *screen, ScreenCell *cell)
+#ifdef VTERM_COMPACT_CELLS
+static uint32_t color_key(const VTermColor *col)
+{
+  if(VTERM_COLOR_IS_INDEXED(col))
+    return col->type | (uint32_t)col->indexed.idx << 8;
+
+  return col->type | (uint32_t)col->rgb.red << 8 | (uint32_t)col->rgb.green << 16 | (uint32_t)col->rgb.blue << 24;
+}
+
+static PenKey pen_key(const ScreenPen *pen)
 {
-  cell->chars[0] = 0;
-  cell->pen = screen->pen;
+  return (PenKey){
+    .fg    = color_key(&pen->fg),
+    .bg    = color_key(&pen->bg),
+    .attrs = pen->bold
+           | pen->underline << 1
+           | pen->italic << 3
+           | pen->blink << 4
+           | pen->reverse << 5
+           | pen->conceal << 6
+           | pen->strike << 7
+           | pen->font << 8
+           | pen->small << 12
+           | pen->baseline << 13
+           | pen->protected_cell << 15
+           | pen->dwl << 16
+           | pen->dhl << 17,
+  };
+}
+
+static inline int pen_key_equal(const PenKey *a, const PenKey *b)
+{
+  return a->fg == b->fg && a->bg == b->bg && a->attrs == b->attrs;
+}
+
+static inline uint32_t pen_key_hash(const PenKey *key)
+{
+  uint32_t h = key->fg * 0x9e3779b1;
+  h = (h ^ key->bg) * 0x85ebca77;
+  h = (h ^ key->attrs) * 0xc2b2ae3d;
+  return h ^ (h >> 16);
+}
+
+static void rehash_pens(VTermScreen *screen)
+{
+  uint32_t mask = screen->pens_size * 2 - 1;
+
+  memset(screen->pen_hash, 0, sizeof(screen->pen_hash[0]) * screen->pens_size * 2);
+  for(int i = 0; i < screen->npens; i++) {
+    uint32_t h = pen_key_hash(&screen->pen_keys[i]) & mask;
+    while(screen->pen_hash[h])
+      h = (h + 1) & mask;
+    screen->pen_hash[h] = i + 1;
+  }
+
+  screen->last_pen = 0;
+}
+
+static void resize_pens(VTermScreen *screen, int size)
+{
+  ScreenPen *pens = vterm_allocator_malloc(screen->vt, sizeof(pens[0]) * size);
+  PenKey *keys = vterm_allocator_malloc(screen->vt, sizeof(keys[0]) * size);
+
+  if(screen->npens) {
+    memcpy(pens, screen->pens, sizeof(pens[0]) * screen->npens);
+    memcpy(keys, screen->pen_keys, sizeof(keys[0]) * screen->npens);
+  }
+
+  vterm_allocator_free(screen->vt, screen->pens);
+  vterm_allocator_free(screen->vt, screen->pen_keys);
+  vterm_allocator_free(screen->vt, screen->pen_hash);
+
+  screen->pens = pens;
+  screen->pen_keys = keys;
+  screen->pen_hash = vterm_allocator_malloc(screen->vt, sizeof(screen->pen_hash[0]) * size * 2);
+  screen->pens_size = size;
+
+  rehash_pens(screen);
+}
+
+static inline int cell_has_overflow(const ScreenCell *cell)
+{
+  return (cell->ch & CELL_OVERFLOW) && cell->ch != (uint32_t)-1;
+}
+
+/* Drop the pens and combining sequences no cell refers to anymore */
+static void gc_cells(VTermScreen *screen, int pens, int overflow)
+{
+  int ncells = screen->rows * screen->cols;
+  int nmap = pens ? screen->npens : screen->noverflow;
+  int *map = vterm_allocator_malloc(screen->vt, sizeof(int) * nmap);
+  memset(map, 0, sizeof(int) * nmap);
+
+  for(int bufidx = 0; bufidx < 2; bufidx++) {
+    ScreenCell *buffer = screen->buffers[bufidx];
+    for(int i = 0; buffer && i < ncells; i++) {
+      if(pens)
+        map[buffer[i].pen] = 1;
+      else if(cell_has_overflow(&buffer[i]))
+        map[buffer[i].ch & CELL_MAX_OVERFLOW] = 1;
+    }
+  }
+
+  int n = 0;
+  if(pens) {
+    for(int i = 0; i < screen->npens; i++)
+      if(map[i]) {
+        screen->pens[n] = screen->pens[i];
+        screen->pen_keys[n] = screen->pen_keys[i];
+        map[i] = n++;
+      }
+    screen->npens = n;
+    rehash_pens(screen);
+  }
+  else {
+    for(int i = 0; i < screen->noverflow; i++)
+      if(map[i]) {
+        memcpy(screen->overflow[n], screen->overflow[i], sizeof(screen->overflow[0]));
+        map[i] = n++;
+      }
+    screen->noverflow = n;
+  }
+
+  for(int bufidx = 0; bufidx < 2; bufidx++) {
+    ScreenCell *buffer = screen->buffers[bufidx];
+    for(int i = 0; buffer && i < ncells; i++) {
+      if(pens)
+        buffer[i].pen = map[buffer[i].pen];
+      else if(cell_has_overflow(&buffer[i]))
+        buffer[i].ch = CELL_OVERFLOW | map[buffer[i].ch & CELL_MAX_OVERFLOW];
+    }
+  }
+
+  vterm_allocator_free(screen->vt, map);
+}
+
+static PenRef pen_ref(VTermScreen *screen, const ScreenPen *pen)
+{
+  PenKey key = pen_key(pen);
+
+  if(screen->npens && pen_key_equal(&key, &screen->pen_keys[screen->last_pen]))
+    return screen->last_pen;
+
+  uint32_t mask = screen->pens_size * 2 - 1;
+  uint32_t h = pen_key_hash(&key) & mask;
+  for(; screen->pen_hash[h]; h = (h + 1) & mask) {
+    int i = screen->pen_hash[h] - 1;
+    if(pen_key_equal(&key, &screen->pen_keys[i]))
+      return screen->last_pen = i;
+  }
+
+  if(screen->npens == screen->pens_size) {
+    if(screen->pens_size * CELL_GC_RATIO >= screen->rows * screen->cols && !screen->resizing)
+      gc_cells(screen, 1, 0);
+    if(screen->npens > screen->pens_size / 2 && screen->pens_size < CELL_MAX_PENS)
+      resize_pens(screen, screen->pens_size * 2);
+    if(screen->npens == screen->pens_size)
+      /* Every pen is in use. Only on a huge screen full of colours */
+      return 0;
+
+    /* Probe again, in the rebuilt hash */
+    mask = screen->pens_size * 2 - 1;
+    for(h = pen_key_hash(&key) & mask; screen->pen_hash[h]; h = (h + 1) & mask)
+      ;
+  }
+
+  int i = screen->npens++;
+  screen->pens[i] = *pen;
+  screen->pen_keys[i] = key;
+  screen->pen_hash[h] = i + 1;
+
+  return screen->last_pen = i;
+}
+
+static inline const ScreenPen *cell_pen(const VTermScreen *screen, const ScreenCell *cell)
+{
+  return &screen->pens[cell->pen];
+}
+
+/* Sets a single codepoint, or 0 or (uint32_t)-1 */
+static inline void cell_set_char(ScreenCell *cell, uint32_t c)
+{
+  cell->ch = c;
+}
+
+static void cell_set_chars(VTermScreen *screen, ScreenCell *cell, const uint32_t chars[])
+{
+  if(!chars[0] || !chars[1]) {
+    cell->ch = chars[0];
+    return;
+  }
+
+  uint32_t seq[VTERM_MAX_CHARS_PER_CELL] = { 0 };
+  for(int i = 0; i < VTERM_MAX_CHARS_PER_CELL && chars[i]; i++)
+    seq[i] = chars[i];
+
+  /* The same sequence as last time, e.g. when a decomposed accent repeats */
+  if(screen->noverflow && !memcmp(screen->overflow[screen->noverflow - 1], seq, sizeof(seq))) {
+    cell->ch = CELL_OVERFLOW | (screen->noverflow - 1);
+    return;
+  }
+
+  if(screen->noverflow == screen->overflow_size) {
+    if(screen->overflow_size * CELL_GC_RATIO >= screen->rows * screen->cols && !screen->resizing)
+      gc_cells(screen, 0, 1);
+    if(screen->noverflow > screen->overflow_size / 2 || !screen->overflow_size) {
+      int size = screen->overflow_size ? screen->overflow_size * 2 : 16;
+      uint32_t (*overflow)[VTERM_MAX_CHARS_PER_CELL] = vterm_allocator_malloc(screen->vt, sizeof(overflow[0]) * size);
+      if(screen->noverflow)
+        memcpy(overflow, screen->overflow, sizeof(overflow[0]) * screen->noverflow);
+      vterm_allocator_free(screen->vt, screen->overflow);
+      screen->overflow = overflow;
+      screen->overflow_size = size;
+    }
+  }
+
+  if(screen->noverflow == CELL_MAX_OVERFLOW) {
+    /* Keep the base character at least */
+    cell->ch = chars[0];
+    return;
+  }
+
+  memcpy(screen->overflow[screen->noverflow], seq, sizeof(seq));
+  cell->ch = CELL_OVERFLOW | screen->noverflow++;
+}
+
+/* The chars of a cell, terminated by 0 unless VTERM_MAX_CHARS_PER_CELL long.
+ * buf holds them if they don't live anywhere else */
+static inline const uint32_t *cell_chars(const VTermScreen *screen, const ScreenCell *cell, uint32_t buf[2])
+{
+  if(cell_has_overflow(cell))
+    return screen->overflow[cell->ch & CELL_MAX_OVERFLOW];
+
+  buf[0] = cell->ch;
+  buf[1] = 0;
+  return buf;
+}
+
+static inline int cell_is_erased(const ScreenCell *cell)
+{
+  return cell->ch == 0;
+}
+
+static inline int cell_is_widegap(const ScreenCell *cell)
+{
+  return cell->ch == (uint32_t)-1;
+}
+#else
+static inline PenRef pen_ref(VTermScreen *screen, const ScreenPen *pen)
+{
+  return *pen;
+}
+
+static inline const ScreenPen *cell_pen(const VTermScreen *screen, const ScreenCell *cell)
+{
+  return &cell->pen;
+}
+
+/* Sets a single codepoint, or 0 or (uint32_t)-1 */
+static inline void cell_set_char(ScreenCell *cell, uint32_t c)
+{
+  cell->chars[0] = c;
+  cell->chars[1] = 0;
+}
+
+static void cell_set_chars(VTermScreen *screen, ScreenCell *cell, const uint32_t chars[])
+{
+  int i;
+  for(i = 0; i < VTERM_MAX_CHARS_PER_CELL && chars[i]; i++)
+    cell->chars[i] = chars[i];
+  if(i < VTERM_MAX_CHARS_PER_CELL)
+    cell->chars[i] = 0;
+}
+
+/* The chars of a cell, terminated by 0 unless VTERM_MAX_CHARS_PER_CELL long */
+static inline const uint32_t *cell_chars(const VTermScreen *screen, const ScreenCell *cell, uint32_t buf[2])
+{
+  return cell->chars;
+}
+
+static inline int cell_is_erased(const ScreenCell *cell)
+{
+  return cell->chars[0] == 0;
+}
+
+static inline int cell_is_widegap(const ScreenCell *cell)
+{
+  return cell->chars[0] == (uint32_t)-1;
+}
+#endif
+
+static inline void clearcell(VTermScreen *screen, ScreenCell *cell)
+{
+  cell_set_char(cell, 0);
+  cell->pen = pen_ref(screen, &screen->pen);
 }
 
 static inline ScreenCell *getcell(const VTermScreen *screen, int row, int col)
@@ -91,10 +433,12 @@ static inline ScreenCell *getcell(const VTermScreen *screen, int row, int col)
 static ScreenCell *alloc_buffer(VTermScreen *screen, int rows, int cols)
 {
   ScreenCell *new_buffer = vterm_allocator_malloc(screen->vt, sizeof(ScreenCell) * rows * cols);
+  PenRef pen = pen_ref(screen, &screen->pen);
 
   for(int row = 0; row < rows; row++) {
     for(int col = 0; col < cols; col++) {
-      clearcell(screen, &new_buffer[row * cols + col]);
+      cell_set_char(&new_buffer[row * cols + col], 0);
+      new_buffer[row * cols + col].pen = pen;
     }
   }
 
@@ -178,16 +522,16 @@ static int putglyph(VTermGlyphInfo *info, VTermPos pos, void *user)
   if(!cell)
     return 0;
 
-  int i;
-  for(i = 0; i < VTERM_MAX_CHARS_PER_CELL && info->chars[i]; i++) {
-    cell->chars[i] = info->chars[i];
-    cell->pen = screen->pen;
-  }
-  if(i < VTERM_MAX_CHARS_PER_CELL)
-    cell->chars[i] = 0;
+  ScreenPen pen = screen->pen;
+  pen.protected_cell = info->protected_cell;
+  pen.dwl            = info->dwl;
+  pen.dhl            = info->dhl;
+
+  cell->pen = pen_ref(screen, &pen);
+  cell_set_chars(screen, cell, info->chars);
 
   for(int col = 1; col < info->width; col++)
-    getcell(screen, pos.row, pos.col + col)->chars[0] = (uint32_t)-1;
+    cell_set_char(getcell(screen, pos.row, pos.col + col), (uint32_t)-1);
 
   VTermRect rect = {
     .start_row = pos.row,
@@ -196,15 +540,50 @@ static int putglyph(VTermGlyphInfo *info, VTermPos pos, void *user)
     .end_col   = pos.col+info->width,
   };
 
-  cell->pen.protected_cell = info->protected_cell;
-  cell->pen.dwl            = info->dwl;
-  cell->pen.dhl            = info->dhl;
-
   damagerect(screen, rect);
 
   return 1;
 }
 
+static int putascii(const char bytes[], int len, VTermGlyphInfo *info, VTermPos pos, void *user)
+{
+  VTermScreen *screen = user;
+  ScreenCell *cell = getcell(screen, pos.row, pos.col);
+
+  if(!cell || pos.col + len > screen->cols)
+    return 0;
+
+  ScreenPen pen = screen->pen;
+  pen.protected_cell = info->protected_cell;
+  pen.dwl            = info->dwl;
+  pen.dhl            = info->dhl;
+
+  PenRef ref = pen_ref(screen, &pen);
+
+  /* A row is contiguous in the buffer */
+  for(int i = 0; i < len; i++, cell++) {
+    cell_set_char(cell, (unsigned char)bytes[i]);
+    cell->pen = ref;
+  }
+
+  VTermRect rect = {
+    .start_row = pos.row,
+    .end_row   = pos.row+1,
+    .start_col = pos.col,
+    .end_col   = pos.col+len,
+  };
+
+  if(screen->damage_merge == VTERM_DAMAGE_CELL) {
+    /* Cell damage is promised per cell */
+    for(rect.end_col = rect.start_col + 1; rect.start_col < pos.col + len; rect.start_col++, rect.end_col++)
+      damagerect(screen, rect);
+  }
+  else
+    damagerect(screen, rect);
+
+  return 1;
+}
+
 static void sb_pushline_from_row(VTermScreen *screen, int row)
 {
   VTermPos pos = { .row = row };
@@ -274,20 +653,24 @@ static int erase_internal(VTermRect rect, int selective, void *user)
   for(int row = rect.start_row; row < screen->state->rows && row < rect.end_row; row++) {
     const VTermLineInfo *info = vterm_state_get_lineinfo(screen->state, row);
 
+    ScreenPen pen = {
+      /* Only copy .fg and .bg; leave things like rv in reset state */
+      .fg = screen->pen.fg,
+      .bg = screen->pen.bg,
+    };
+    pen.dwl = info->doublewidth;
+    pen.dhl = info->doubleheight;
+
+    PenRef ref = pen_ref(screen, &pen);
+
     for(int col = rect.start_col; col < rect.end_col; col++) {
       ScreenCell *cell = getcell(screen, row, col);
 
-      if(selective && cell->pen.protected_cell)
+      if(selective && cell_pen(screen, cell)->protected_cell)
         continue;
 
-      cell->chars[0] = 0;
-      cell->pen = (ScreenPen){
-        /* Only copy .fg and .bg; leave things like rv in reset state */
-        .fg = screen->pen.fg,
-        .bg = screen->pen.bg,
-      };
-      cell->pen.dwl = info->doublewidth;
-      cell->pen.dhl = info->doubleheight;
+      cell_set_char(cell, 0);
+      cell->pen = ref;
     }
   }
 
@@ -497,7 +880,7 @@ static int bell(void *user)
 static int line_popcount(ScreenCell *buffer, int row, int rows, int cols)
 {
   int col = cols - 1;
-  while(col >= 0 && buffer[row * cols + col].chars[0] == 0)
+  while(col >= 0 && cell_is_erased(&buffer[row * cols + col]))
     col--;
   return col + 1;
 }
@@ -685,28 +1068,27 @@ static void resize_buffer(VTermScreen *screen, int bufidx, int new_rows, int new
         VTermScreenCell *src = &screen->sb_buffer[pos.col];
         ScreenCell *dst = &new_buffer[pos.row * new_cols + pos.col];
 
-        for(int i = 0; i < VTERM_MAX_CHARS_PER_CELL; i++) {
-          dst->chars[i] = src->chars[i];
-          if(!src->chars[i])
-            break;
-        }
+        cell_set_chars(screen, dst, src->chars);
+
+        ScreenPen pen = { 0 };
+        pen.bold      = src->attrs.bold;
+        pen.underline = src->attrs.underline;
+        pen.italic    = src->attrs.italic;
+        pen.blink     = src->attrs.blink;
+        pen.reverse   = src->attrs.reverse ^ screen->global_reverse;
+        pen.conceal   = src->attrs.conceal;
+        pen.strike    = src->attrs.strike;
+        pen.font      = src->attrs.font;
+        pen.small     = src->attrs.small;
+        pen.baseline  = src->attrs.baseline;
 
-        dst->pen.bold      = src->attrs.bold;
-        dst->pen.underline = src->attrs.underline;
-        dst->pen.italic    = src->attrs.italic;
-        dst->pen.blink     = src->attrs.blink;
-        dst->pen.reverse   = src->attrs.reverse ^ screen->global_reverse;
-        dst->pen.conceal   = src->attrs.conceal;
-        dst->pen.strike    = src->attrs.strike;
-        dst->pen.font      = src->attrs.font;
-        dst->pen.small     = src->attrs.small;
-        dst->pen.baseline  = src->attrs.baseline;
+        pen.fg = src->fg;
+        pen.bg = src->bg;
 
-        dst->pen.fg = src->fg;
-        dst->pen.bg = src->bg;
+        dst->pen = pen_ref(screen, &pen);
 
         if(src->width == 2 && pos.col < (new_cols-1))
-          (dst + 1)->chars[0] = (uint32_t) -1;
+          cell_set_char(dst + 1, (uint32_t) -1);
       }
       for( ; pos.col < new_cols; pos.col++)
         clearcell(screen, &new_buffer[pos.row * new_cols + pos.col]);
@@ -760,6 +1142,9 @@ static int resize(int new_rows, int new_cols, VTermStateFields *fields, void *us
     screen->sb_buffer = vterm_allocator_malloc(screen->vt, sizeof(VTermScreenCell) * new_cols);
   }
 
+#ifdef VTERM_COMPACT_CELLS
+  screen->resizing = true;
+#endif
   resize_buffer(screen, 0, new_rows, new_cols, !altscreen_active, fields);
   if(screen->buffers[BUFIDX_ALTSCREEN])
     resize_buffer(screen, 1, new_rows, new_cols, altscreen_active, fields);
@@ -774,6 +1159,9 @@ static int resize(int new_rows, int new_cols, VTermStateFields *fields, void *us
 
     fields->lineinfos[BUFIDX_ALTSCREEN] = new_lineinfo;
   }
+#ifdef VTERM_COMPACT_CELLS
+  screen->resizing = false;
+#endif
 
   screen->buffer = altscreen_active ? screen->buffers[BUFIDX_ALTSCREEN] : screen->buffers[BUFIDX_PRIMARY];
 
@@ -804,8 +1192,10 @@ static int setlineinfo(int row, const VTermLineInfo *newinfo, const VTermLineInf
      newinfo->doubleheight != oldinfo->doubleheight) {
     for(int col = 0; col < screen->cols; col++) {
       ScreenCell *cell = getcell(screen, row, col);
-      cell->pen.dwl = newinfo->doublewidth;
-      cell->pen.dhl = newinfo->doubleheight;
+      ScreenPen pen = *cell_pen(screen, cell);
+      pen.dwl = newinfo->doublewidth;
+      pen.dhl = newinfo->doubleheight;
+      cell->pen = pen_ref(screen, &pen);
     }
 
     VTermRect rect = {
@@ -848,6 +1238,7 @@ static VTermStateCallbacks state_cbs = {
   .resize      = &resize,
   .setlineinfo = &setlineinfo,
   .sb_clear    = &sb_clear,
+  .putascii    = &putascii,
 };
 
 static VTermScreen *screen_new(VTerm *vt)
@@ -877,6 +1268,19 @@ static VTermScreen *screen_new(VTerm *vt)
   screen->callbacks = NULL;
   screen->cbdata    = NULL;
 
+#ifdef VTERM_COMPACT_CELLS
+  screen->pens = NULL;
+  screen->pen_keys = NULL;
+  screen->pen_hash = NULL;
+  screen->npens = 0;
+  resize_pens(screen, 16);
+
+  screen->overflow = NULL;
+  screen->noverflow = screen->overflow_size = 0;
+
+  screen->resizing = false;
+#endif
+
   screen->buffers[BUFIDX_PRIMARY] = alloc_buffer(screen, rows, cols);
 
   screen->buffer = screen->buffers[BUFIDX_PRIMARY];
@@ -896,6 +1300,13 @@ INTERNAL void vterm_screen_free(VTermScreen *screen)
 
   vterm_allocator_free(screen->vt, screen->sb_buffer);
 
+#ifdef VTERM_COMPACT_CELLS
+  vterm_allocator_free(screen->vt, screen->pens);
+  vterm_allocator_free(screen->vt, screen->pen_keys);
+  vterm_allocator_free(screen->vt, screen->pen_hash);
+  vterm_allocator_free(screen->vt, screen->overflow);
+#endif
+
   vterm_allocator_free(screen->vt, screen);
 }
 
@@ -931,10 +1342,10 @@ static size_t _get_chars(const VTermScreen *screen, const int utf8, void *buffer
     for(int col = rect.start_col; col < rect.end_col; col++) {
       ScreenCell *cell = getcell(screen, row, col);
 
-      if(cell->chars[0] == 0)
+      if(cell_is_erased(cell))
         // Erased cell, might need a space
         padding++;
-      else if(cell->chars[0] == (uint32_t)-1)
+      else if(cell_is_widegap(cell))
         // Gap behind a double-width char, do nothing
         ;
       else {
@@ -942,8 +1353,10 @@ static size_t _get_chars(const VTermScreen *screen, const int utf8, void *buffer
           PUT(UNICODE_SPACE);
           padding--;
         }
-        for(int i = 0; i < VTERM_MAX_CHARS_PER_CELL && cell->chars[i]; i++) {
-          PUT(cell->chars[i]);
+        uint32_t buf[2];
+        const uint32_t *chars = cell_chars(screen, cell, buf);
+        for(int i = 0; i < VTERM_MAX_CHARS_PER_CELL && chars[i]; i++) {
+          PUT(chars[i]);
         }
       }
     }
@@ -974,31 +1387,35 @@ int vterm_screen_get_cell(const VTermScreen *screen, VTermPos pos, VTermScreenCe
   if(!intcell)
     return 0;
 
+  uint32_t buf[2];
+  const uint32_t *chars = cell_chars(screen, intcell, buf);
   for(int i = 0; i < VTERM_MAX_CHARS_PER_CELL; i++) {
-    cell->chars[i] = intcell->chars[i];
-    if(!intcell->chars[i])
+    cell->chars[i] = chars[i];
+    if(!chars[i])
       break;
   }
 
-  cell->attrs.bold      = intcell->pen.bold;
-  cell->attrs.underline = intcell->pen.underline;
-  cell->attrs.italic    = intcell->pen.italic;
-  cell->attrs.blink     = intcell->pen.blink;
-  cell->attrs.reverse   = intcell->pen.reverse ^ screen->global_reverse;
-  cell->attrs.conceal   = intcell->pen.conceal;
-  cell->attrs.strike    = intcell->pen.strike;
-  cell->attrs.font      = intcell->pen.font;
-  cell->attrs.small     = intcell->pen.small;
-  cell->attrs.baseline  = intcell->pen.baseline;
+  const ScreenPen *pen = cell_pen(screen, intcell);
 
-  cell->attrs.dwl = intcell->pen.dwl;
-  cell->attrs.dhl = intcell->pen.dhl;
+  cell->attrs.bold      = pen->bold;
+  cell->attrs.underline = pen->underline;
+  cell->attrs.italic    = pen->italic;
+  cell->attrs.blink     = pen->blink;
+  cell->attrs.reverse   = pen->reverse ^ screen->global_reverse;
+  cell->attrs.conceal   = pen->conceal;
+  cell->attrs.strike    = pen->strike;
+  cell->attrs.font      = pen->font;
+  cell->attrs.small     = pen->small;
+  cell->attrs.baseline  = pen->baseline;
 
-  cell->fg = intcell->pen.fg;
-  cell->bg = intcell->pen.bg;
+  cell->attrs.dwl = pen->dwl;
+  cell->attrs.dhl = pen->dhl;
+
+  cell->fg = pen->fg;
+  cell->bg = pen->bg;
 
   if(pos.col < (screen->cols - 1) &&
-     getcell(screen, pos.row, pos.col + 1)->chars[0] == (uint32_t)-1)
+     cell_is_widegap(getcell(screen, pos.row, pos.col + 1)))
     cell->width = 2;
   else
     cell->width = 1;
@@ -1011,7 +1428,7 @@ int vterm_screen_is_eol(const VTermScreen *screen, VTermPos pos)
   /* This cell is EOL if this and every cell to the right is black */
   for(; pos.col < screen->cols; pos.col++) {
     ScreenCell *cell = getcell(screen, pos.row, pos.col);
-    if(cell->chars[0] != 0)
+    if(!cell_is_erased(cell))
       return 0;
   }
 
@@ -1094,31 +1511,39 @@ void vterm_screen_set_damage_merge(VTermScreen *screen, VTermDamageSize size)
   screen->damage_merge = size;
 }
 
-static int attrs_differ(VTermAttrMask attrs, ScreenCell *a, ScreenCell *b)
+static int attrs_differ(const VTermScreen *screen, VTermAttrMask attrs, ScreenCell *acell, ScreenCell *bcell)
 {
-  if((attrs & VTERM_ATTR_BOLD_MASK)       && (a->pen.bold != b->pen.bold))
+#ifdef VTERM_COMPACT_CELLS
+  if(acell->pen == bcell->pen)
+    return 0;
+#endif
+
+  const ScreenPen *a = cell_pen(screen, acell);
+  const ScreenPen *b = cell_pen(screen, bcell);
+
+  if((attrs & VTERM_ATTR_BOLD_MASK)       && (a->bold != b->bold))
     return 1;
-  if((attrs & VTERM_ATTR_UNDERLINE_MASK)  && (a->pen.underline != b->pen.underline))
+  if((attrs & VTERM_ATTR_UNDERLINE_MASK)  && (a->underline != b->underline))
     return 1;
-  if((attrs & VTERM_ATTR_ITALIC_MASK)     && (a->pen.italic != b->pen.italic))
+  if((attrs & VTERM_ATTR_ITALIC_MASK)     && (a->italic != b->italic))
     return 1;
-  if((attrs & VTERM_ATTR_BLINK_MASK)      && (a->pen.blink != b->pen.blink))
+  if((attrs & VTERM_ATTR_BLINK_MASK)      && (a->blink != b->blink))
     return 1;
-  if((attrs & VTERM_ATTR_REVERSE_MASK)    && (a->pen.reverse != b->pen.reverse))
+  if((attrs & VTERM_ATTR_REVERSE_MASK)    && (a->reverse != b->reverse))
     return 1;
-  if((attrs & VTERM_ATTR_CONCEAL_MASK)    && (a->pen.conceal != b->pen.conceal))
+  if((attrs & VTERM_ATTR_CONCEAL_MASK)    && (a->conceal != b->conceal))
     return 1;
-  if((attrs & VTERM_ATTR_STRIKE_MASK)     && (a->pen.strike != b->pen.strike))
+  if((attrs & VTERM_ATTR_STRIKE_MASK)     && (a->strike != b->strike))
     return 1;
-  if((attrs & VTERM_ATTR_FONT_MASK)       && (a->pen.font != b->pen.font))
+  if((attrs & VTERM_ATTR_FONT_MASK)       && (a->font != b->font))
     return 1;
-  if((attrs & VTERM_ATTR_FOREGROUND_MASK) && !vterm_color_is_equal(&a->pen.fg, &b->pen.fg))
+  if((attrs & VTERM_ATTR_FOREGROUND_MASK) && !vterm_color_is_equal(&a->fg, &b->fg))
     return 1;
-  if((attrs & VTERM_ATTR_BACKGROUND_MASK) && !vterm_color_is_equal(&a->pen.bg, &b->pen.bg))
+  if((attrs & VTERM_ATTR_BACKGROUND_MASK) && !vterm_color_is_equal(&a->bg, &b->bg))
     return 1;
-  if((attrs & VTERM_ATTR_SMALL_MASK)    && (a->pen.small != b->pen.small))
+  if((attrs & VTERM_ATTR_SMALL_MASK)    && (a->small != b->small))
     return 1;
-  if((attrs & VTERM_ATTR_BASELINE_MASK)    && (a->pen.baseline != b->pen.baseline))
+  if((attrs & VTERM_ATTR_BASELINE_MASK)    && (a->baseline != b->baseline))
     return 1;
 
   return 0;
@@ -1140,12 +1565,12 @@ int vterm_screen_get_attrs_extent(const VTermScreen *screen, VTermRect *extent,
   int col;
 
   for(col = pos.col - 1; col >= extent->start_col; col--)
-    if(attrs_differ(attrs, target, getcell(screen, pos.row, col)))
+    if(attrs_differ(screen, attrs, target, getcell(screen, pos.row, col)))
       break;
   extent->start_col = col + 1;
 
   for(col = pos.col + 1; col < extent->end_col; col++)
-    if(attrs_differ(attrs, target, getcell(screen, pos.row, col)))
+    if(attrs_differ(screen, attrs, target, getcell(screen, pos.row, col)))
       break;
   extent->end_col = col - 1;
 
@@ -1159,6 +1584,18 @@ void vterm_screen_convert_color_to_rgb(const VTermScreen *screen, VTermColor *co
 
 static void reset_default_colours(VTermScreen *screen, ScreenCell *buffer)
 {
+#ifdef VTERM_COMPACT_CELLS
+  /* Every cell's pen is in the table, whichever buffer it is in */
+  for(int i = 0; i < screen->npens; i++) {
+    ScreenPen *pen = &screen->pens[i];
+    if(VTERM_COLOR_IS_DEFAULT_FG(&pen->fg))
+      pen->fg = screen->pen.fg;
+    if(VTERM_COLOR_IS_DEFAULT_BG(&pen->bg))
+      pen->bg = screen->pen.bg;
+    screen->pen_keys[i] = pen_key(pen);
+  }
+  rehash_pens(screen);
+#else
   for(int row = 0; row <= screen->rows - 1; row++)
     for(int col = 0; col <= screen->cols - 1; col++) {
       ScreenCell *cell = &buffer[row * screen->cols + col];
@@ -1167,6 +1604,7 @@ static void reset_default_colours(VTermScreen *screen, ScreenCell *buffer)
       if(VTERM_COLOR_IS_DEFAULT_BG(&cell->pen.bg))
         cell->pen.bg = screen->pen.bg;
     }
+#endif
 }
 
 void vterm_screen_set_default_colors(VTermScreen *screen, const VTermColor *default_fg, const VTermColor *default_bg)
@@ -1186,6 +1624,8 @@ void vterm_screen_set_default_colors(VTermScreen *screen, const VTermColor *defa
   }
 
   reset_default_colours(screen, screen->buffers[0]);
+#ifndef VTERM_COMPACT_CELLS
   if(screen->buffers[1])
     reset_default_colours(screen, screen->buffers[1]);
+#endif
 }
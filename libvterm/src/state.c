@@ -269,10 +269,76 @@ static void set_lineinfo(VTermState *state, int row, int force, int dwl, int dhl
     state->lineinfo[row] = info;
 }
 
+/* Runs of printable ASCII need no decoding, width lookups or combining: they
+ * go to the putascii callback a row span at a time. Returns the number of
+ * bytes written, 0 to leave them to the generic path */
+static size_t on_text_ascii(VTermState *state, const char bytes[], size_t len)
+{
+  if(state->gsingle_set || state->mode.insert || !state->mode.autowrap ||
+     !state->callbacks || !state->callbacks->putascii ||
+     !vterm_encoding_passes_ascii(&state->encoding[state->gl_set]))
+    return 0;
+
+  size_t runlen = vterm_scan_printable(bytes, len);
+
+  VTermPos oldpos = state->pos;
+  size_t eaten = 0;
+
+  while(eaten < runlen) {
+    if(state->at_phantom || state->pos.col >= THISROWWIDTH(state)) {
+      linefeed(state);
+      state->pos.col = 0;
+      state->at_phantom = 0;
+      state->lineinfo[state->pos.row].continuation = 1;
+    }
+
+    int row_width = THISROWWIDTH(state);
+    int count = row_width - state->pos.col;
+    if(runlen - eaten < (size_t)count)
+      count = runlen - eaten;
+
+    VTermGlyphInfo info = {
+      .chars = NULL,
+      .width = 1,
+      .protected_cell = state->protected_cell,
+      .dwl = state->lineinfo[state->pos.row].doublewidth,
+      .dhl = state->lineinfo[state->pos.row].doubleheight,
+    };
+
+    if(!(*state->callbacks->putascii)(bytes + eaten, count, &info, state->pos, state->cbdata))
+      break;
+
+    eaten += count;
+
+    /* The last glyph, in case a combining char or REP follows */
+    state->combine_chars[0] = (unsigned char)bytes[eaten - 1];
+    state->combine_chars[1] = 0;
+    state->combine_width = 1;
+    state->combine_pos.row = state->pos.row;
+    state->combine_pos.col = state->pos.col + count - 1;
+
+    if(state->pos.col + count >= row_width) {
+      state->pos.col = row_width - 1;
+      state->at_phantom = 1;
+    }
+    else {
+      state->pos.col += count;
+    }
+  }
+
+  updatecursor(state, &oldpos, 0);
+
+  return eaten;
+}
+
 static int on_text(const char bytes[], size_t len, void *user)
 {
   VTermState *state = user;
 
+  size_t ascii_eaten = on_text_ascii(state, bytes, len);
+  if(ascii_eaten)
+    return ascii_eaten;
+
   VTermPos oldpos = state->pos;
 
   uint32_t *codepoints = (uint32_t *)(state->vt->tmpbuffer);
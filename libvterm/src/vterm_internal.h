@@ -286,9 +286,13 @@ enum {
 
 void vterm_state_push_output_sprintf_CSI(VTermState *vts, const char *format, ...);
 
+size_t vterm_scan_printable(const char *bytes, size_t len);
+
 void vterm_screen_free(VTermScreen *screen);
 
 VTermEncoding *vterm_lookup_encoding(VTermEncodingType type, char designation);
+/* Whether printable ASCII decodes to itself, one codepoint per byte */
+int vterm_encoding_passes_ascii(const VTermEncodingInstance *inst);
 
 int vterm_unicode_width(uint32_t codepoint);
 int vterm_unicode_is_combining(uint32_t codepoint);
@@ -0,0 +1,83 @@
+/* Throughput of vterm_input_write() through the full screen layer, for
+ * typical log output and for output dominated by long OSC strings.
+ *
+ *   make bench && ./build/bench_parser.host [megabytes]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "vterm.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Compiler output and dmesg-like lines, with the occasional SGR */
+static size_t make_log(char *buf, size_t size)
+{
+  size_t len = 0;
+  for(unsigned long line = 0; len + 256 < size; line++) {
+    if(line % 16 == 0)
+      len += sprintf(buf + len, "\x1b[1;31mwarning:\x1b[0m src/file%lu.c:%lu: unused variable 'x%lu'\r\n", line % 97, line, line);
+    else
+      len += sprintf(buf + len, "[%8lu.%06lu] usb 1-1: new high-speed USB device number %lu using ci_hdrc\r\n", line / 1000, line % 1000000, line % 128);
+  }
+  return len;
+}
+
+/* Clipboard copies (OSC 52, base64) and title updates around a prompt */
+static size_t make_osc(char *buf, size_t size)
+{
+  static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  size_t len = 0;
+  for(unsigned long n = 0; len + 4096 < size; n++) {
+    len += sprintf(buf + len, "\x1b]2;user@kobo: ~/src/project%lu\a$ ", n % 10);
+    len += sprintf(buf + len, "\x1b]52;c;");
+    for(int i = 0; i < 2048; i++)
+      buf[len++] = b64[(n + i * 7) % 64];
+    len += sprintf(buf + len, "\x1b\\\r\n");
+  }
+  return len;
+}
+
+static double run(const char *buf, size_t len)
+{
+  VTerm *vt = vterm_new(50, 100);
+  vterm_set_utf8(vt, 1);
+  VTermScreen *screen = vterm_obtain_screen(vt);
+  vterm_screen_set_damage_merge(screen, VTERM_DAMAGE_SCROLL);
+  vterm_screen_reset(screen, 1);
+
+  double start = now();
+  for(size_t pos = 0; pos < len; pos += 4096) {
+    vterm_input_write(vt, buf + pos, len - pos < 4096 ? len - pos : 4096);
+    vterm_screen_flush_damage(screen);
+  }
+  double t = now() - start;
+
+  vterm_free(vt);
+  return t;
+}
+
+int main(int argc, char *argv[])
+{
+  size_t size = (argc > 1 ? strtoul(argv[1], NULL, 10) : 16) * 1024 * 1024;
+  char *buf = malloc(size);
+
+  size_t len = make_log(buf, size);
+  printf("log  %8.2f MB/s\n", len / (1024.0 * 1024.0) / run(buf, len));
+
+  len = make_osc(buf, size);
+  printf("osc  %8.2f MB/s\n", len / (1024.0 * 1024.0) / run(buf, len));
+
+  free(buf);
+  return 0;
+}
@@ -0,0 +1,81 @@
+/* Cost of reading and scrolling a screen the size of a Kobo Libra's at
+ * fontmult 1 (1264x1680 in 8x8 cells), as VTermToFBInk does: every cell
+ * read back with vterm_screen_get_cell(), and linefeeds at the bottom.
+ * Build libvterm with and without VTERM_COMPACT_CELLS to compare.
+ *
+ *   make bench && ./build/bench_screen.host [iterations]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "vterm.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ROWS 210
+#define COLS 158
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Coloured prompts and ls output, with the odd accent */
+static void fill(VTerm *vt)
+{
+  char line[COLS * 16];
+  for(int row = 0; row < ROWS; row++) {
+    int len = 0;
+    for(int word = 0; len < COLS * 4; word++) {
+      if(word % 8 == 0)
+        len += sprintf(line + len, "\x1b[1;3%dm", (row + word) % 8);
+      len += sprintf(line + len, "file%d%s \x1b[0m", row * 31 + word, word % 13 ? "" : "e\xcc\x81");
+    }
+    vterm_input_write(vt, line, len);
+    vterm_input_write(vt, "\r\n", 2);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int iterations = argc > 1 ? atoi(argv[1]) : 200;
+
+  VTerm *vt = vterm_new(ROWS, COLS);
+  vterm_set_utf8(vt, 1);
+  VTermScreen *screen = vterm_obtain_screen(vt);
+  vterm_screen_set_damage_merge(screen, VTERM_DAMAGE_SCROLL);
+  vterm_screen_enable_altscreen(screen, 1);
+  vterm_screen_reset(screen, 1);
+  fill(vt);
+
+  long checksum = 0;
+  double start = now();
+  for(int i = 0; i < iterations; i++) {
+    VTermPos pos;
+    VTermScreenCell cell;
+    for(pos.row = 0; pos.row < ROWS; pos.row++)
+      for(pos.col = 0; pos.col < COLS; pos.col++) {
+        vterm_screen_get_cell(screen, pos, &cell);
+        checksum += cell.chars[0] + cell.fg.indexed.idx;
+      }
+  }
+  double t = now() - start;
+  printf("get_cell scan %8.2f ns/cell\n", t * 1e9 / ((double)iterations * ROWS * COLS));
+
+  start = now();
+  for(int i = 0; i < iterations * 10; i++) {
+    vterm_input_write(vt, "\n", 1);
+    vterm_screen_flush_damage(screen);
+  }
+  t = now() - start;
+  printf("scroll        %8.2f us/line\n", t * 1e6 / (iterations * 10));
+
+  printf("checksum %ld\n", checksum);
+  vterm_free(vt);
+  return 0;
+}
@@ -58,7 +58,7 @@ struct kbkey osk_keys[61] = {
     { .mod = NOMOD, .text = "a", .normal = "a", .shift = "A", .fn = "", .x = 1.75f, .y = 2.00f, .w = 1.00f, .h = 1.00f, {}, },
     { .mod = NOMOD, .text = "s", .normal = "s", .shift = "S", .fn = "", .x = 2.75f, .y = 2.00f, .w = 1.00f, .h = 1.00f, {}, },
     { .mod = NOMOD, .text = "d", .normal = "d", .shift = "D", .fn = "", .x = 3.75f, .y = 2.00f, .w = 1.00f, .h = 1.00f, {}, },
-    { .mod = NOMOD, .text = "f", .normal = "f", .shift = "F", .fn = "", .x = 4.75f, .y = 2.00f, .w = 1.00f, .h = 1.00f, {}, },
+    { .mod = NOMOD, .text = "f", .normal = "f", .shift = "F", .fn = "Find", .x = 4.75f, .y = 2.00f, .w = 1.00f, .h = 1.00f, {}, },
     { .mod = NOMOD, .text = "g", .normal = "g", .shift = "G", .fn = "", .x = 5.75f, .y = 2.00f, .w = 1.00f, .h = 1.00f, {}, },
     { .mod = NOMOD, .text = "h", .normal = "h", .shift = "H", .fn = "", .x = 6.75f, .y = 2.00f, .w = 1.00f, .h = 1.00f, {}, },
     { .mod = NOMOD, .text = "j", .normal = "j", .shift = "J", .fn = "", .x = 7.75f, .y = 2.00f, .w = 1.00f, .h = 1.00f, {}, },
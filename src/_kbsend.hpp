@@ -17,234 +17,298 @@ unsigned char src_kbsend_html[] = {
   0x65, 0x20, 0x69, 0x64, 0x3d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x20,
   0x61, 0x75, 0x74, 0x6f, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x3e, 0x3c, 0x2f,
   0x69, 0x6e, 0x70, 0x75, 0x74, 0x3e, 0x3c, 0x2f, 0x62, 0x72, 0x3e, 0x0a,
-  0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x6f, 0x75, 0x74,
-  0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x3c, 0x73,
-  0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x6b, 0x62, 0x64, 0x20, 0x7b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
-  0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65,
-  0x65, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64,
-  0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x33,
-  0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64,
-  0x65, 0x72, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69,
-  0x64, 0x20, 0x23, 0x62, 0x34, 0x62, 0x34, 0x62, 0x34, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33,
-  0x33, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70,
-  0x6c, 0x61, 0x79, 0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70,
-  0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x32, 0x70, 0x78, 0x20,
-  0x34, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72,
-  0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x20, 0x31, 0x70, 0x78,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2d,
-  0x73, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x77, 0x72, 0x61,
-  0x70, 0x3b, 0x0a, 0x7d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65,
-  0x3e, 0x0a, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a,
-  0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x6f, 0x75, 0x74, 0x20,
-  0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
-  0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49,
-  0x64, 0x28, 0x27, 0x6f, 0x75, 0x74, 0x27, 0x29, 0x0a, 0x76, 0x61, 0x72,
-  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70, 0x20, 0x3d, 0x20, 0x64, 0x6f,
+  0x46, 0x69, 0x6e, 0x64, 0x3a, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x20, 0x61, 0x75, 0x74, 0x6f, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c,
+  0x69, 0x7a, 0x65, 0x3d, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x69, 0x64, 0x3d,
+  0x66, 0x69, 0x6e, 0x64, 0x3e, 0x3c, 0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x3e, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x69, 0x64,
+  0x3d, 0x66, 0x69, 0x6e, 0x64, 0x62, 0x74, 0x6e, 0x3e, 0x46, 0x69, 0x6e,
+  0x64, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f,
+  0x62, 0x72, 0x3e, 0x0a, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64,
+  0x3d, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69,
+  0x76, 0x3e, 0x0a, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d,
+  0x6f, 0x75, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a,
+  0x0a, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x6b, 0x62, 0x64,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x23, 0x65, 0x65, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73,
+  0x3a, 0x20, 0x33, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73,
+  0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x62, 0x34, 0x62, 0x34, 0x62, 0x34,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x23, 0x33, 0x33, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64,
+  0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69,
+  0x6e, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x32,
+  0x70, 0x78, 0x20, 0x34, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x20,
+  0x31, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69,
+  0x74, 0x65, 0x2d, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x20, 0x6e, 0x6f,
+  0x77, 0x72, 0x61, 0x70, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x66, 0x6f, 0x75,
+  0x6e, 0x64, 0x20, 0x64, 0x69, 0x76, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79,
+  0x3a, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2d, 0x73,
+  0x70, 0x61, 0x63, 0x65, 0x3a, 0x20, 0x70, 0x72, 0x65, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a,
+  0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x7d, 0x0a, 0x3c, 0x2f, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x6f,
+  0x75, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6f, 0x75, 0x74, 0x27, 0x29, 0x0a,
+  0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70, 0x20, 0x3d,
+  0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65,
+  0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64,
+  0x28, 0x27, 0x69, 0x70, 0x27, 0x29, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f,
   0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
-  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x69,
-  0x70, 0x27, 0x29, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x65, 0x6d,
-  0x70, 0x6f, 0x72, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
-  0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x6f, 0x72, 0x74,
-  0x27, 0x29, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x6d,
-  0x6f, 0x62, 0x69, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
-  0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6d, 0x6f, 0x62,
-  0x69, 0x6c, 0x65, 0x27, 0x29, 0x0a, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e,
-  0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x27, 0x69, 0x70, 0x27,
-  0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65,
-  0x6d, 0x69, 0x70, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
-  0x2e, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x27, 0x69, 0x70,
-  0x27, 0x29, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70, 0x2e, 0x76,
-  0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f,
-  0x77, 0x2e, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x68,
-  0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a,
-  0x69, 0x70, 0x2e, 0x6f, 0x6e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3d,
-  0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x65, 0x29,
-  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x73, 0x65, 0x74, 0x49,
-  0x74, 0x65, 0x6d, 0x28, 0x27, 0x69, 0x70, 0x27, 0x2c, 0x20, 0x65, 0x6c,
-  0x65, 0x6d, 0x69, 0x70, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x0a,
-  0x7d, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x6c, 0x6f, 0x67, 0x28, 0x78, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x76, 0x61, 0x72, 0x20, 0x6b, 0x65, 0x79, 0x6e, 0x6f, 0x64, 0x65,
-  0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
-  0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
-  0x74, 0x28, 0x27, 0x6b, 0x62, 0x64, 0x27, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x6b, 0x65, 0x79, 0x6e, 0x6f, 0x64, 0x65, 0x2e, 0x69, 0x6e, 0x6e,
-  0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3d, 0x20, 0x53, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x28, 0x78, 0x29, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61,
-  0x63, 0x65, 0x28, 0x27, 0x20, 0x27, 0x2c, 0x20, 0x27, 0x5f, 0x27, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x6f, 0x75, 0x74,
-  0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64,
-  0x28, 0x6b, 0x65, 0x79, 0x6e, 0x6f, 0x64, 0x65, 0x29, 0x0a, 0x7d, 0x0a,
-  0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f,
-  0x48, 0x65, 0x78, 0x28, 0x73, 0x74, 0x72, 0x2c, 0x68, 0x65, 0x78, 0x29,
-  0x7b, 0x0a, 0x20, 0x20, 0x74, 0x72, 0x79, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x68, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x75, 0x6e, 0x65,
-  0x73, 0x63, 0x61, 0x70, 0x65, 0x28, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65,
-  0x55, 0x52, 0x49, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
-  0x28, 0x73, 0x74, 0x72, 0x29, 0x29, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74,
-  0x28, 0x27, 0x27, 0x29, 0x2e, 0x6d, 0x61, 0x70, 0x28, 0x66, 0x75, 0x6e,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x76, 0x29, 0x7b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20,
-  0x72, 0x20, 0x3d, 0x20, 0x76, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x43, 0x6f,
-  0x64, 0x65, 0x41, 0x74, 0x28, 0x30, 0x29, 0x2e, 0x74, 0x6f, 0x53, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x28, 0x31, 0x36, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72,
-  0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30,
-  0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x27, 0x30, 0x30,
-  0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
-  0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6e, 0x20, 0x27, 0x30, 0x27, 0x20, 0x2b, 0x20, 0x72, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
-  0x72, 0x6e, 0x20, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x29, 0x2e, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x27, 0x27, 0x29, 0x0a, 0x20,
-  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65,
-  0x29, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6e, 0x20, 0x27, 0x27, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20,
-  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x68, 0x65, 0x78, 0x0a,
-  0x7d, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x28, 0x65, 0x29, 0x20, 0x7b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x2e, 0x74,
-  0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x65, 0x6c, 0x65,
-  0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x7c, 0x7c, 0x20, 0x65, 0x2e, 0x74,
-  0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x65, 0x6c, 0x65,
-  0x6d, 0x69, 0x70, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x27, 0x77, 0x72, 0x6f, 0x6e,
-  0x67, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x27, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x2e, 0x63, 0x74, 0x72, 0x6c, 0x4b,
-  0x65, 0x79, 0x29, 0x20, 0x7b, 0x20, 0x2f, 0x2f, 0x20, 0x68, 0x61, 0x6e,
-  0x64, 0x6c, 0x65, 0x20, 0x5e, 0x57, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x45,
-  0x76, 0x69, 0x6c, 0x43, 0x74, 0x72, 0x6c, 0x57, 0x20, 0x3d, 0x20, 0x66,
-  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x65, 0x29, 0x20, 0x7b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65,
-  0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6e, 0x20, 0x22, 0x5e, 0x57, 0x22, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x2c, 0x20, 0x20, 0x63, 0x6c,
-  0x65, 0x61, 0x72, 0x45, 0x76, 0x69, 0x6c, 0x43, 0x74, 0x72, 0x6c, 0x57,
-  0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28,
-  0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x72,
-  0x65, 0x6d, 0x6f, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-  0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x75, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x27, 0x2c, 0x20, 0x73,
-  0x74, 0x6f, 0x70, 0x45, 0x76, 0x69, 0x6c, 0x43, 0x74, 0x72, 0x6c, 0x57,
-  0x2c, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65,
-  0x6f, 0x75, 0x74, 0x28, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x45, 0x76, 0x69,
-  0x6c, 0x43, 0x74, 0x72, 0x6c, 0x57, 0x2c, 0x20, 0x31, 0x30, 0x30, 0x30,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77,
-  0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65,
-  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x75, 0x6e, 0x6c, 0x6f, 0x61, 0x64,
-  0x27, 0x2c, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x45, 0x76, 0x69, 0x6c, 0x43,
-  0x74, 0x72, 0x6c, 0x57, 0x2c, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x29,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x0a,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x70,
+  0x6f, 0x72, 0x74, 0x27, 0x29, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+  0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x27, 0x29, 0x0a, 0x76, 0x61, 0x72,
+  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x3d, 0x20,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+  0x27, 0x66, 0x69, 0x6e, 0x64, 0x27, 0x29, 0x0a, 0x76, 0x61, 0x72, 0x20,
+  0x65, 0x6c, 0x65, 0x6d, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x3d, 0x20,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+  0x27, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x27, 0x29, 0x0a, 0x0a, 0x69, 0x66,
+  0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61,
+  0x67, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x27,
+  0x69, 0x70, 0x27, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72,
+  0x61, 0x67, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28,
+  0x27, 0x69, 0x70, 0x27, 0x29, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x69,
+  0x70, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x77, 0x69,
+  0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x2e, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x69, 0x70, 0x2e, 0x6f, 0x6e, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x28, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x73,
+  0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x27, 0x69, 0x70, 0x27, 0x2c,
+  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70, 0x2e, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x78, 0x29, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6b, 0x65, 0x79, 0x6e,
+  0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x28, 0x27, 0x6b, 0x62, 0x64, 0x27, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x6e, 0x6f, 0x64, 0x65, 0x2e,
+  0x69, 0x6e, 0x6e, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3d, 0x20,
+  0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x78, 0x29, 0x2e, 0x72, 0x65,
+  0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x27, 0x20, 0x27, 0x2c, 0x20, 0x27,
+  0x5f, 0x27, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d,
+  0x6f, 0x75, 0x74, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68,
+  0x69, 0x6c, 0x64, 0x28, 0x6b, 0x65, 0x79, 0x6e, 0x6f, 0x64, 0x65, 0x29,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x74, 0x6f, 0x48, 0x65, 0x78, 0x28, 0x73, 0x74, 0x72, 0x2c, 0x68,
+  0x65, 0x78, 0x29, 0x7b, 0x0a, 0x20, 0x20, 0x74, 0x72, 0x79, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x78, 0x20, 0x3d, 0x20,
+  0x75, 0x6e, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x28, 0x65, 0x6e, 0x63,
+  0x6f, 0x64, 0x65, 0x55, 0x52, 0x49, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e,
+  0x65, 0x6e, 0x74, 0x28, 0x73, 0x74, 0x72, 0x29, 0x29, 0x2e, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x28, 0x27, 0x27, 0x29, 0x2e, 0x6d, 0x61, 0x70, 0x28,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x76, 0x29, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76,
+  0x61, 0x72, 0x20, 0x72, 0x20, 0x3d, 0x20, 0x76, 0x2e, 0x63, 0x68, 0x61,
+  0x72, 0x43, 0x6f, 0x64, 0x65, 0x41, 0x74, 0x28, 0x30, 0x29, 0x2e, 0x74,
+  0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x31, 0x36, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d,
+  0x3d, 0x20, 0x30, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x27, 0x30, 0x30, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x2e, 0x6c, 0x65, 0x6e,
+  0x67, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x27, 0x30, 0x27, 0x20, 0x2b, 0x20, 0x72,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x29, 0x2e, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x27, 0x27,
+  0x29, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x63, 0x61, 0x74, 0x63,
+  0x68, 0x28, 0x65, 0x29, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x27, 0x27, 0x0a, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x68,
+  0x65, 0x78, 0x0a, 0x7d, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x28, 0x65,
+  0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x65, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3d, 0x3d, 0x20,
+  0x65, 0x6c, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x7c, 0x7c, 0x20,
+  0x65, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3d, 0x3d, 0x20,
+  0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70, 0x20, 0x7c, 0x7c, 0x20, 0x65, 0x2e,
+  0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x66, 0x69, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x27, 0x77,
+  0x72, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x27,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x2e, 0x63, 0x74,
-  0x72, 0x6c, 0x4b, 0x65, 0x79, 0x20, 0x26, 0x26, 0x20, 0x6b, 0x65, 0x79,
-  0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20, 0x31,
+  0x72, 0x6c, 0x4b, 0x65, 0x79, 0x29, 0x20, 0x7b, 0x20, 0x2f, 0x2f, 0x20,
+  0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x5e, 0x57, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 0x74,
+  0x6f, 0x70, 0x45, 0x76, 0x69, 0x6c, 0x43, 0x74, 0x72, 0x6c, 0x57, 0x20,
+  0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x65,
   0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x76, 0x61, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x6b,
-  0x65, 0x79, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x41,
-  0x74, 0x28, 0x30, 0x29, 0x20, 0x26, 0x20, 0x28, 0x30, 0x78, 0x32, 0x30,
-  0x2d, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
-  0x2e, 0x66, 0x72, 0x6f, 0x6d, 0x43, 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64,
-  0x65, 0x28, 0x63, 0x6f, 0x64, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x3d,
-  0x3d, 0x20, 0x38, 0x20, 0x7c, 0x7c, 0x20, 0x65, 0x2e, 0x63, 0x68, 0x61,
-  0x72, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x38, 0x29, 0x20,
-  0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x42, 0x61, 0x63, 0x6b, 0x73,
-  0x70, 0x61, 0x63, 0x65, 0x27, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x6f, 0x72,
-  0x65, 0x20, 0x61, 0x6e, 0x64, 0x72, 0x6f, 0x69, 0x64, 0x2e, 0x2e, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65,
-  0x2e, 0x6b, 0x65, 0x79, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x3d, 0x20,
-  0x34, 0x36, 0x20, 0x7c, 0x7c, 0x20, 0x65, 0x2e, 0x63, 0x68, 0x61, 0x72,
-  0x43, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x34, 0x36, 0x29, 0x20,
-  0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x44, 0x65, 0x6c, 0x65, 0x74,
-  0x65, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63,
-  0x68, 0x20, 0x28, 0x6b, 0x65, 0x79, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x27,
-  0x45, 0x6e, 0x74, 0x65, 0x72, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x20,
-  0x3d, 0x20, 0x27, 0x5c, 0x72, 0x27, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61,
-  0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x61, 0x73, 0x65, 0x20, 0x27, 0x54, 0x61, 0x62, 0x27, 0x3a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e,
+  0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x22, 0x5e, 0x57, 0x22, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x2c, 0x20,
+  0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x45, 0x76, 0x69, 0x6c, 0x43, 0x74,
+  0x72, 0x6c, 0x57, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+  0x77, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6e,
+  0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x62,
+  0x65, 0x66, 0x6f, 0x72, 0x65, 0x75, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x27,
+  0x2c, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x45, 0x76, 0x69, 0x6c, 0x43, 0x74,
+  0x72, 0x6c, 0x57, 0x2c, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54,
+  0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x63, 0x6c, 0x65, 0x61, 0x72,
+  0x45, 0x76, 0x69, 0x6c, 0x43, 0x74, 0x72, 0x6c, 0x57, 0x2c, 0x20, 0x31,
+  0x30, 0x30, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x61, 0x64, 0x64,
+  0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
+  0x72, 0x28, 0x27, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x75, 0x6e, 0x6c,
+  0x6f, 0x61, 0x64, 0x27, 0x2c, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x45, 0x76,
+  0x69, 0x6c, 0x43, 0x74, 0x72, 0x6c, 0x57, 0x2c, 0x20, 0x66, 0x61, 0x6c,
+  0x73, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x65, 0x2e, 0x6b,
+  0x65, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65,
+  0x2e, 0x63, 0x74, 0x72, 0x6c, 0x4b, 0x65, 0x79, 0x20, 0x26, 0x26, 0x20,
+  0x6b, 0x65, 0x79, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d,
+  0x3d, 0x20, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x3d, 0x20, 0x6b, 0x65, 0x79, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x43, 0x6f,
+  0x64, 0x65, 0x41, 0x74, 0x28, 0x30, 0x29, 0x20, 0x26, 0x20, 0x28, 0x30,
+  0x78, 0x32, 0x30, 0x2d, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x53, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x2e, 0x66, 0x72, 0x6f, 0x6d, 0x43, 0x68, 0x61, 0x72,
+  0x43, 0x6f, 0x64, 0x65, 0x28, 0x63, 0x6f, 0x64, 0x65, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x43, 0x6f, 0x64,
+  0x65, 0x20, 0x3d, 0x3d, 0x20, 0x38, 0x20, 0x7c, 0x7c, 0x20, 0x65, 0x2e,
+  0x63, 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x3d, 0x20,
+  0x38, 0x29, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x42, 0x61,
+  0x63, 0x6b, 0x73, 0x70, 0x61, 0x63, 0x65, 0x27, 0x20, 0x2f, 0x2f, 0x20,
+  0x6d, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x72, 0x6f, 0x69, 0x64,
+  0x2e, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x43, 0x6f, 0x64, 0x65, 0x20,
+  0x3d, 0x3d, 0x20, 0x34, 0x36, 0x20, 0x7c, 0x7c, 0x20, 0x65, 0x2e, 0x63,
+  0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x34,
+  0x36, 0x29, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x44, 0x65,
+  0x6c, 0x65, 0x74, 0x65, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x77,
+  0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x6b, 0x65, 0x79, 0x29, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73,
+  0x65, 0x20, 0x27, 0x45, 0x6e, 0x74, 0x65, 0x72, 0x27, 0x3a, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b,
-  0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x5c, 0x74, 0x27, 0x3b, 0x0a, 0x20,
+  0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x5c, 0x72, 0x27, 0x3b, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
   0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x27, 0x43, 0x61, 0x70, 0x73,
-  0x4c, 0x6f, 0x63, 0x6b, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x61, 0x73, 0x65, 0x20, 0x27, 0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x27,
+  0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x27, 0x54, 0x61, 0x62, 0x27,
   0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x5c, 0x78, 0x31,
-  0x62, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x27,
-  0x53, 0x68, 0x69, 0x66, 0x74, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x27, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
-  0x72, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x63, 0x61, 0x73, 0x65, 0x20, 0x27, 0x42, 0x61, 0x63, 0x6b, 0x73, 0x70,
-  0x61, 0x63, 0x65, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20,
-  0x27, 0x5c, 0x78, 0x37, 0x66, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x5c, 0x74, 0x27,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x27, 0x43,
+  0x61, 0x70, 0x73, 0x4c, 0x6f, 0x63, 0x6b, 0x27, 0x3a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x27, 0x45, 0x73, 0x63, 0x61,
+  0x70, 0x65, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27,
+  0x5c, 0x78, 0x31, 0x62, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73,
+  0x65, 0x20, 0x27, 0x53, 0x68, 0x69, 0x66, 0x74, 0x27, 0x3a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
+  0x27, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x27, 0x3a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x27, 0x42, 0x61, 0x63,
+  0x6b, 0x73, 0x70, 0x61, 0x63, 0x65, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79,
+  0x20, 0x3d, 0x20, 0x27, 0x5c, 0x78, 0x37, 0x66, 0x27, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72,
+  0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x27, 0x41, 0x72, 0x72, 0x6f, 0x77,
+  0x55, 0x70, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27,
+  0x5c, 0x78, 0x31, 0x62, 0x5b, 0x41, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61,
+  0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+  0x61, 0x73, 0x65, 0x20, 0x27, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x44, 0x6f,
+  0x77, 0x6e, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27,
+  0x5c, 0x78, 0x31, 0x62, 0x5b, 0x42, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61,
+  0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61,
+  0x73, 0x65, 0x20, 0x27, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x4c, 0x65, 0x66,
+  0x74, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x5c,
+  0x78, 0x31, 0x62, 0x5b, 0x44, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b,
   0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61,
-  0x73, 0x65, 0x20, 0x27, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x55, 0x70, 0x27,
-  0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x5c, 0x78, 0x31,
-  0x62, 0x5b, 0x41, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65,
-  0x20, 0x27, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x44, 0x6f, 0x77, 0x6e, 0x27,
-  0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x5c, 0x78, 0x31,
-  0x62, 0x5b, 0x42, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
-  0x27, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x4c, 0x65, 0x66, 0x74, 0x27, 0x3a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x5c, 0x78, 0x31, 0x62,
-  0x5b, 0x44, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
-  0x27, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x52, 0x69, 0x67, 0x68, 0x74, 0x27,
-  0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27, 0x5c, 0x78, 0x31,
-  0x62, 0x5b, 0x43, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65,
-  0x6e, 0x64, 0x5f, 0x6b, 0x65, 0x79, 0x28, 0x6b, 0x65, 0x79, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66,
-  0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x66, 0x75, 0x6e,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x6b,
-  0x65, 0x79, 0x28, 0x6b, 0x65, 0x79, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x3d,
-  0x20, 0x74, 0x6f, 0x48, 0x65, 0x78, 0x28, 0x6b, 0x65, 0x79, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x62, 0x6f, 0x64, 0x79,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x68, 0x6f,
+  0x73, 0x65, 0x20, 0x27, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x52, 0x69, 0x67,
+  0x68, 0x74, 0x27, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x27,
+  0x5c, 0x78, 0x31, 0x62, 0x5b, 0x43, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61,
+  0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x6b, 0x65, 0x79, 0x28, 0x6b, 0x65,
+  0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a,
+  0x2f, 0x2f, 0x20, 0x4b, 0x65, 0x79, 0x73, 0x20, 0x67, 0x6f, 0x20, 0x6f,
+  0x76, 0x65, 0x72, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65,
+  0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20,
+  0x61, 0x73, 0x20, 0x72, 0x61, 0x77, 0x20, 0x55, 0x54, 0x46, 0x2d, 0x38,
+  0x0a, 0x76, 0x61, 0x72, 0x20, 0x77, 0x73, 0x20, 0x3d, 0x20, 0x6e, 0x75,
+  0x6c, 0x6c, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65,
+  0x64, 0x20, 0x3d, 0x20, 0x27, 0x27, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+  0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x73, 0x20,
+  0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63,
+  0x6b, 0x65, 0x74, 0x28, 0x27, 0x77, 0x73, 0x3a, 0x2f, 0x2f, 0x27, 0x20,
+  0x2b, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70, 0x2e, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x3a, 0x27, 0x20, 0x2b, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2b, 0x20, 0x27, 0x2f, 0x27, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x77, 0x73, 0x2e, 0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x3d,
+  0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x71, 0x75, 0x65, 0x75, 0x65, 0x64, 0x2e, 0x6c, 0x65, 0x6e,
+  0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77,
+  0x73, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x71, 0x75, 0x65, 0x75, 0x65,
+  0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x64, 0x20, 0x3d, 0x20,
+  0x27, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77,
+  0x73, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x3d, 0x20,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67,
+  0x28, 0x27, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+  0x65, 0x64, 0x27, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x77, 0x73, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x65, 0x6c, 0x65, 0x6d,
+  0x69, 0x70, 0x2e, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20,
+  0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x2e, 0x6f,
+  0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x3d, 0x20, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x73, 0x29, 0x20, 0x77,
+  0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x6f,
+  0x73, 0x74, 0x5f, 0x6b, 0x65, 0x79, 0x28, 0x6b, 0x65, 0x79, 0x29, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x68, 0x6f,
   0x73, 0x74, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70, 0x2e,
   0x76, 0x61, 0x6c, 0x75, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61,
   0x72, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65,
@@ -256,103 +320,456 @@ unsigned char src_kbsend_html[] = {
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74,
   0x68, 0x6f, 0x64, 0x3a, 0x20, 0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x2c,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64,
-  0x79, 0x3a, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x72, 0x65, 0x73, 0x20,
-  0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x2e,
-  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x74, 0x65, 0x78, 0x74, 0x20,
-  0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x2e,
-  0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x20, 0x3d, 0x3e, 0x20, 0x7b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67,
-  0x28, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x0a, 0x7d,
-  0x0a, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x6f,
-  0x6e, 0x6b, 0x65, 0x79, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x66,
+  0x79, 0x3a, 0x20, 0x74, 0x6f, 0x48, 0x65, 0x78, 0x28, 0x6b, 0x65, 0x79,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65,
+  0x6e, 0x28, 0x72, 0x65, 0x73, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x72, 0x65, 0x73, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e,
+  0x28, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x29, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28,
+  0x65, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x65, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x6b, 0x65,
+  0x79, 0x28, 0x6b, 0x65, 0x79, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x6f, 0x67, 0x28, 0x74, 0x6f, 0x48, 0x65, 0x78, 0x28, 0x6b,
+  0x65, 0x79, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x21, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x57, 0x65, 0x62,
+  0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6f, 0x73, 0x74, 0x5f, 0x6b,
+  0x65, 0x79, 0x28, 0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77,
+  0x73, 0x20, 0x26, 0x26, 0x20, 0x77, 0x73, 0x2e, 0x72, 0x65, 0x61, 0x64,
+  0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x57, 0x65,
+  0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x4f, 0x50, 0x45, 0x4e,
+  0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x77, 0x73, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x6b, 0x65, 0x79, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x28, 0x72, 0x65, 0x29, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+  0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x20, 0x6f,
+  0x6e, 0x63, 0x65, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x64, 0x20,
+  0x2b, 0x3d, 0x20, 0x6b, 0x65, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x77, 0x73, 0x29, 0x20,
+  0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x50, 0x61,
+  0x73, 0x74, 0x65, 0x73, 0x20, 0x67, 0x6f, 0x20, 0x69, 0x6e, 0x20, 0x6f,
+  0x6e, 0x65, 0x20, 0x72, 0x61, 0x77, 0x20, 0x75, 0x70, 0x6c, 0x6f, 0x61,
+  0x64, 0x2c, 0x20, 0x62, 0x72, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x70,
+  0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x73,
+  0x6b, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x61,
+  0x73, 0x74, 0x65, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x27, 0x70, 0x61, 0x73,
+  0x74, 0x65, 0x20, 0x27, 0x20, 0x2b, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2e,
+  0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x68, 0x74, 0x74, 0x70, 0x3a,
+  0x2f, 0x2f, 0x27, 0x20, 0x2b, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70,
+  0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x3a, 0x27,
+  0x20, 0x2b, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x2e,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x2f, 0x70, 0x61,
+  0x73, 0x74, 0x65, 0x27, 0x2c, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x20,
+  0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3a,
+  0x20, 0x7b, 0x20, 0x27, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d,
+  0x54, 0x79, 0x70, 0x65, 0x27, 0x3a, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6c,
+  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6f, 0x63, 0x74, 0x65,
+  0x74, 0x2d, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x27, 0x20, 0x7d, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64,
+  0x79, 0x3a, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x42, 0x6c, 0x6f, 0x62, 0x28,
+  0x5b, 0x74, 0x65, 0x78, 0x74, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x29, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x20, 0x3d,
+  0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x67, 0x28, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x53, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x72,
+  0x6f, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x73, 0x68,
+  0x6f, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x65,
+  0x73, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x2c, 0x20, 0x6f, 0x72,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x63, 0x6c, 0x69,
+  0x63, 0x6b, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x2e, 0x0a, 0x2f, 0x2f, 0x20, 0x41, 0x6e, 0x20,
+  0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
+  0x20, 0x67, 0x6f, 0x65, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74,
+  0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20, 0x73,
+  0x63, 0x72, 0x65, 0x65, 0x6e, 0x2e, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x28, 0x6c, 0x69, 0x6e,
+  0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72,
+  0x20, 0x75, 0x72, 0x6c, 0x20, 0x3d, 0x20, 0x27, 0x68, 0x74, 0x74, 0x70,
+  0x3a, 0x2f, 0x2f, 0x27, 0x20, 0x2b, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x69,
+  0x70, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x3a,
+  0x27, 0x20, 0x2b, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x74,
+  0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x2f, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x3f, 0x71, 0x3d, 0x27, 0x20, 0x2b, 0x20,
+  0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x55, 0x52, 0x49, 0x43, 0x6f, 0x6d,
+  0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x66,
+  0x69, 0x6e, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x6e, 0x65, 0x20,
+  0x21, 0x3d, 0x3d, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x64, 0x29, 0x20, 0x75, 0x72, 0x6c, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x26,
+  0x6c, 0x69, 0x6e, 0x65, 0x3d, 0x27, 0x20, 0x2b, 0x20, 0x6c, 0x69, 0x6e,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28,
+  0x75, 0x72, 0x6c, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x72, 0x65,
+  0x73, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65,
+  0x73, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x74, 0x65, 0x78,
+  0x74, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x66, 0x6f, 0x75, 0x6e, 0x64,
+  0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x3d,
+  0x20, 0x27, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x27,
+  0x5c, 0x6e, 0x27, 0x29, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68,
+  0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20,
+  0x74, 0x61, 0x62, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x2e,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x28, 0x27, 0x5c, 0x74, 0x27,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x61, 0x62, 0x20, 0x3c, 0x20,
+  0x30, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61,
+  0x72, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x27, 0x64, 0x69, 0x76,
+  0x27, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x2e, 0x69, 0x6e, 0x6e, 0x65,
+  0x72, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x2e, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28,
+  0x74, 0x61, 0x62, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x20, 0x3d, 0x20,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20,
+  0x7b, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x28, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x2e, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x30,
+  0x2c, 0x20, 0x74, 0x61, 0x62, 0x29, 0x29, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 0x61, 0x70, 0x70, 0x65,
+  0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6e, 0x6f, 0x64, 0x65,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x2e, 0x63, 0x61, 0x74, 0x63,
+  0x68, 0x28, 0x65, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x65, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x66,
+  0x69, 0x6e, 0x64, 0x62, 0x74, 0x6e, 0x27, 0x29, 0x2e, 0x6f, 0x6e, 0x63,
+  0x6c, 0x69, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0x20, 0x66, 0x69, 0x6e,
+  0x64, 0x28, 0x29, 0x20, 0x7d, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x66, 0x69,
+  0x6e, 0x64, 0x2e, 0x6f, 0x6e, 0x6b, 0x65, 0x79, 0x64, 0x6f, 0x77, 0x6e,
+  0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x28, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x27,
+  0x45, 0x6e, 0x74, 0x65, 0x72, 0x27, 0x29, 0x20, 0x66, 0x69, 0x6e, 0x64,
+  0x28, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x2e, 0x73, 0x74, 0x6f,
+  0x70, 0x50, 0x72, 0x6f, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x28, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x6f, 0x6e, 0x70, 0x61, 0x73, 0x74, 0x65, 0x20, 0x3d,
+  0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x65,
+  0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x65, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3d, 0x3d, 0x20,
+  0x65, 0x6c, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x7c, 0x7c, 0x20,
+  0x65, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3d, 0x3d, 0x20,
+  0x65, 0x6c, 0x65, 0x6d, 0x69, 0x70, 0x20, 0x7c, 0x7c, 0x20, 0x65, 0x2e,
+  0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x66, 0x69, 0x6e, 0x64, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x74,
+  0x65, 0x28, 0x65, 0x2e, 0x63, 0x6c, 0x69, 0x70, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x44, 0x61, 0x74, 0x61, 0x2e, 0x67, 0x65, 0x74, 0x44, 0x61, 0x74,
+  0x61, 0x28, 0x27, 0x74, 0x65, 0x78, 0x74, 0x27, 0x29, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74,
+  0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x6f, 0x6e,
+  0x6b, 0x65, 0x79, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x2e, 0x6b,
+  0x65, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x27, 0x50, 0x72, 0x6f, 0x63, 0x65,
+  0x73, 0x73, 0x27, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x61, 0x6e, 0x64, 0x72, 0x6f, 0x69,
+  0x64, 0x2e, 0x2e, 0x2e, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28,
+  0x27, 0x47, 0x6f, 0x74, 0x20, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+  0x2e, 0x2e, 0x2e, 0x27, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65,
+  0x2e, 0x6f, 0x6e, 0x6b, 0x65, 0x79, 0x75, 0x70, 0x20, 0x3d, 0x20, 0x66,
   0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x65, 0x29, 0x20,
-  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x2e,
-  0x6b, 0x65, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x27, 0x50, 0x72, 0x6f, 0x63,
-  0x65, 0x73, 0x73, 0x27, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x61, 0x6e, 0x64, 0x72, 0x6f,
-  0x69, 0x64, 0x2e, 0x2e, 0x2e, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67,
-  0x28, 0x27, 0x47, 0x6f, 0x74, 0x20, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x73,
-  0x73, 0x2e, 0x2e, 0x2e, 0x27, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c,
-  0x65, 0x2e, 0x6f, 0x6e, 0x6b, 0x65, 0x79, 0x75, 0x70, 0x20, 0x3d, 0x20,
-  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x65, 0x29,
-  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5b, 0x27, 0x45, 0x6e, 0x74,
-  0x65, 0x72, 0x27, 0x2c, 0x20, 0x27, 0x42, 0x61, 0x63, 0x6b, 0x73, 0x70,
-  0x61, 0x63, 0x65, 0x27, 0x2c, 0x20, 0x27, 0x44, 0x65, 0x6c, 0x65, 0x74,
-  0x65, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x5d, 0x2e, 0x69, 0x6e, 0x64,
-  0x65, 0x78, 0x4f, 0x66, 0x28, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x29, 0x20,
-  0x21, 0x3d, 0x20, 0x2d, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5b, 0x27, 0x45, 0x6e, 0x74, 0x65,
+  0x72, 0x27, 0x2c, 0x20, 0x27, 0x42, 0x61, 0x63, 0x6b, 0x73, 0x70, 0x61,
+  0x63, 0x65, 0x27, 0x2c, 0x20, 0x27, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65,
+  0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x5d, 0x2e, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x4f, 0x66, 0x28, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x29, 0x20, 0x21,
+  0x3d, 0x20, 0x2d, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x73,
-  0x70, 0x61, 0x63, 0x65, 0x20, 0x65, 0x74, 0x63, 0x2e, 0x2e, 0x0a, 0x20,
+  0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x73, 0x70,
+  0x61, 0x63, 0x65, 0x20, 0x65, 0x74, 0x63, 0x2e, 0x2e, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x2e, 0x6b, 0x65, 0x79,
-  0x20, 0x3d, 0x3d, 0x20, 0x27, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
-  0x27, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x20, 0x2f,
-  0x2f, 0x20, 0x61, 0x6e, 0x64, 0x72, 0x6f, 0x69, 0x64, 0x2e, 0x2e, 0x2e,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x27, 0x6f, 0x6e,
-  0x6b, 0x65, 0x79, 0x75, 0x70, 0x27, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x20,
+  0x3d, 0x3d, 0x20, 0x27, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x27,
+  0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x20, 0x2f, 0x2f,
+  0x20, 0x61, 0x6e, 0x64, 0x72, 0x6f, 0x69, 0x64, 0x2e, 0x2e, 0x2e, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6c, 0x61, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x65, 0x2e, 0x77, 0x68, 0x69,
-  0x63, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
-  0x65, 0x73, 0x73, 0x28, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-  0x6f, 0x6e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x28, 0x65, 0x29, 0x20, 0x7b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x27,
-  0x6f, 0x6e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x27, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-  0x20, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65,
-  0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74,
-  0x68, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x26, 0x26, 0x20, 0x65, 0x6c, 0x65,
-  0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75,
-  0x65, 0x20, 0x21, 0x3d, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x27, 0x6f, 0x6e, 0x6b,
+  0x65, 0x79, 0x75, 0x70, 0x27, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x61, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x65, 0x2e, 0x77, 0x68, 0x69, 0x63,
+  0x68, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x73, 0x73, 0x28, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
+  0x6e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x28, 0x65, 0x29, 0x20, 0x7b, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x6b, 0x65, 0x79,
+  0x2f, 0x2f, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x6b, 0x65, 0x79, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x27, 0x6f,
+  0x6e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x27, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
   0x28, 0x65, 0x6c, 0x65, 0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e,
-  0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67,
-  0x28, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x54, 0x72, 0x61, 0x6e, 0x73,
-  0x66, 0x65, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x65, 0x2e, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x54, 0x79, 0x70, 0x65, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c,
-  0x65, 0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e, 0x6f, 0x6e, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x0a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+  0x20, 0x3e, 0x20, 0x30, 0x20, 0x26, 0x26, 0x20, 0x65, 0x6c, 0x65, 0x6d,
+  0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x21, 0x3d, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7b, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x6b, 0x65, 0x79, 0x28,
   0x65, 0x6c, 0x65, 0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e, 0x76,
-  0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x27, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c,
-  0x65, 0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e, 0x6f, 0x6e, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x6f, 0x6e, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74,
-  0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x6d,
-  0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e, 0x6f, 0x6e, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x20, 0x3d, 0x20, 0x6f, 0x6e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x6f, 0x6e, 0x6b, 0x65, 0x79, 0x64, 0x6f,
-  0x77, 0x6e, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
-  0x73, 0x73, 0x28, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
-  0x7d, 0x0a, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a
+  0x61, 0x6c, 0x75, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28,
+  0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66,
+  0x65, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x28, 0x65, 0x2e, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x54, 0x79, 0x70, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65,
+  0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e, 0x6f, 0x6e, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x27, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65,
+  0x6d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2e, 0x6f, 0x6e, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x6f, 0x6e, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44,
+  0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x6d, 0x6f,
+  0x62, 0x69, 0x6c, 0x65, 0x2e, 0x6f, 0x6e, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x20, 0x3d, 0x20, 0x6f, 0x6e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+  0x65, 0x6e, 0x74, 0x2e, 0x6f, 0x6e, 0x6b, 0x65, 0x79, 0x64, 0x6f, 0x77,
+  0x6e, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
+  0x73, 0x28, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x7d,
+  0x0a, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a
+};
+unsigned int src_kbsend_html_len = 6887;
+unsigned char src_kbsend_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x59,
+  0x6d, 0x6f, 0xdb, 0x38, 0x12, 0xfe, 0xee, 0x5f, 0xc1, 0xa6, 0x40, 0x25,
+  0xa1, 0xb6, 0x62, 0x6f, 0x8b, 0x6e, 0xe1, 0xc4, 0x39, 0xb4, 0x49, 0x76,
+  0xb7, 0xb8, 0xee, 0x35, 0xd8, 0xa4, 0xe8, 0x87, 0xee, 0x0b, 0x68, 0x89,
+  0xb6, 0x78, 0x91, 0x49, 0x2d, 0x45, 0xd9, 0xc9, 0xed, 0xe6, 0xbf, 0xdf,
+  0x0c, 0x49, 0x49, 0x94, 0xfc, 0xd2, 0xb4, 0x77, 0x29, 0x8a, 0x48, 0xe4,
+  0xf0, 0x99, 0xe1, 0xbc, 0x8f, 0x72, 0xba, 0x62, 0x9a, 0x12, 0x41, 0x57,
+  0x6c, 0x76, 0xb4, 0xe6, 0x6c, 0x53, 0x48, 0xa5, 0x8f, 0x48, 0x22, 0x85,
+  0x66, 0x42, 0xcf, 0x8e, 0x36, 0x3c, 0xd5, 0xd9, 0x2c, 0x65, 0x6b, 0x9e,
+  0xb0, 0x91, 0x79, 0x19, 0x12, 0x2e, 0xb8, 0xe6, 0x34, 0x1f, 0x95, 0x09,
+  0xcd, 0xd9, 0x6c, 0x72, 0x74, 0x36, 0x18, 0xbc, 0x2b, 0xa6, 0xe4, 0x94,
+  0x8b, 0xa2, 0xd2, 0x84, 0xa7, 0x33, 0x5e, 0x9c, 0x9d, 0x1e, 0x9b, 0x37,
+  0xf8, 0x3d, 0x57, 0x67, 0x83, 0x2b, 0x00, 0xf5, 0x09, 0x90, 0x09, 0x59,
+  0xd3, 0xbc, 0x62, 0xb3, 0xef, 0x5f, 0x8f, 0xc7, 0x3d, 0xea, 0x9f, 0xe5,
+  0x9c, 0xe7, 0xac, 0xa1, 0xa7, 0x95, 0x96, 0x09, 0x2d, 0xb8, 0xa6, 0x39,
+  0xff, 0x0f, 0x9b, 0x09, 0x29, 0x18, 0x62, 0xac, 0x0c, 0x95, 0xd9, 0x5d,
+  0xc8, 0xa4, 0x2a, 0x7b, 0x20, 0x3f, 0x70, 0x91, 0x7e, 0x09, 0x62, 0x01,
+  0x34, 0xcd, 0x31, 0x72, 0x3a, 0xaf, 0xb4, 0x96, 0xa2, 0xde, 0x98, 0x6b,
+  0x71, 0x86, 0x20, 0x00, 0x67, 0xd6, 0x1d, 0xee, 0xe0, 0x34, 0xe5, 0x6b,
+  0x43, 0x23, 0x2b, 0x38, 0x3d, 0x38, 0x3d, 0x86, 0x77, 0x6f, 0x59, 0x02,
+  0x54, 0xbb, 0x58, 0xea, 0xfb, 0x9c, 0x9d, 0x0d, 0x6e, 0xe7, 0x29, 0xf9,
+  0x6b, 0x40, 0xe0, 0x67, 0x4e, 0x93, 0xdb, 0xa5, 0xc2, 0xa3, 0xa3, 0x44,
+  0xe6, 0x52, 0x4d, 0xc9, 0x53, 0xc6, 0xd8, 0x89, 0xdd, 0x93, 0x2a, 0x65,
+  0x6a, 0xa4, 0x68, 0xca, 0xab, 0x72, 0x4a, 0x5e, 0x14, 0x77, 0xfe, 0xfa,
+  0x94, 0x4c, 0x8a, 0x3b, 0x52, 0xca, 0x9c, 0xa7, 0xe4, 0xe9, 0xfc, 0x25,
+  0xfe, 0xb3, 0xdb, 0x35, 0xce, 0x8b, 0x17, 0x2f, 0xec, 0x42, 0xca, 0xcb,
+  0x22, 0xa7, 0xf7, 0x53, 0x30, 0x54, 0xce, 0x05, 0x1b, 0xcd, 0x73, 0x99,
+  0xdc, 0xda, 0xad, 0x82, 0xa6, 0x29, 0x17, 0xcb, 0x29, 0xf9, 0x0e, 0xb0,
+  0x5e, 0xd6, 0x0c, 0x56, 0x54, 0x2d, 0xb9, 0x98, 0x92, 0x31, 0x2c, 0x4e,
+  0xea, 0xc5, 0x4d, 0xc6, 0x35, 0x1b, 0x95, 0x05, 0x4d, 0xc0, 0x14, 0x42,
+  0x6e, 0x14, 0x2d, 0x4e, 0x06, 0x0f, 0x83, 0xa7, 0xe6, 0xde, 0x04, 0x6f,
+  0x6b, 0x6f, 0xb4, 0x00, 0x57, 0x19, 0x2d, 0xe8, 0x8a, 0xe7, 0xc0, 0x71,
+  0x25, 0x85, 0x34, 0x47, 0x76, 0x60, 0x14, 0xca, 0xad, 0xca, 0x35, 0x53,
+  0x8b, 0x5c, 0x6e, 0xa6, 0x24, 0xe3, 0x69, 0xca, 0x84, 0xbb, 0x46, 0xa5,
+  0x4a, 0xbc, 0x47, 0x21, 0x39, 0xf8, 0x9e, 0x42, 0x5e, 0xa7, 0xc7, 0x4e,
+  0x7f, 0xa0, 0xc8, 0x44, 0xf1, 0x02, 0x34, 0xbb, 0xa6, 0x8a, 0xb0, 0x9c,
+  0xad, 0x40, 0xcd, 0x64, 0x46, 0x52, 0x30, 0xfc, 0x0a, 0xfc, 0x34, 0x5e,
+  0x32, 0x7d, 0x09, 0xab, 0xf0, 0xf8, 0xf6, 0xfe, 0x5d, 0x1a, 0x06, 0xb0,
+  0x1d, 0x44, 0x0d, 0x31, 0x2f, 0x0e, 0xd1, 0xf2, 0xc2, 0x23, 0x35, 0x9e,
+  0x79, 0x80, 0x18, 0xf7, 0x3d, 0x72, 0xe7, 0x84, 0x07, 0x0e, 0x58, 0x0a,
+  0xef, 0x08, 0xfa, 0xd6, 0xa1, 0x03, 0xb8, 0xef, 0x93, 0x1b, 0x75, 0x1f,
+  0xa2, 0x47, 0x02, 0x38, 0x30, 0xe0, 0x0b, 0x12, 0x82, 0xa5, 0x69, 0x7e,
+  0xad, 0xa5, 0xa2, 0x4b, 0x86, 0x94, 0xef, 0x34, 0x5b, 0xd9, 0x1b, 0x46,
+  0xce, 0x5c, 0x56, 0x1f, 0xb1, 0x09, 0x3e, 0x80, 0xdd, 0x7f, 0x60, 0xf0,
+  0x00, 0xb4, 0x25, 0xdb, 0x7d, 0x6c, 0x03, 0x42, 0xca, 0x4d, 0x8c, 0xa7,
+  0x35, 0x97, 0x22, 0xce, 0x64, 0xa9, 0x31, 0x87, 0xa0, 0xd5, 0x06, 0x40,
+  0x27, 0x85, 0x0d, 0xbc, 0x19, 0x59, 0x54, 0x22, 0x41, 0x92, 0x90, 0xd5,
+  0x12, 0x74, 0x58, 0x96, 0x1e, 0xcb, 0x61, 0x87, 0x4b, 0x84, 0x50, 0xf5,
+  0x69, 0x38, 0xb4, 0x0c, 0xef, 0x6a, 0x04, 0xd4, 0xcd, 0x2d, 0xbb, 0x17,
+  0x32, 0xed, 0xa8, 0x3e, 0x51, 0x8c, 0x6a, 0xe6, 0x94, 0x13, 0x06, 0x10,
+  0x74, 0x70, 0x0b, 0xa4, 0x77, 0xb4, 0x31, 0x17, 0x82, 0xa9, 0x1b, 0x76,
+  0x87, 0x72, 0x5d, 0x6b, 0x05, 0x81, 0x00, 0x98, 0xb1, 0x62, 0x10, 0x2d,
+  0x09, 0x0b, 0x03, 0x02, 0x12, 0x04, 0x7f, 0xb8, 0x33, 0xce, 0xc9, 0x62,
+  0x5a, 0x14, 0x4c, 0xa4, 0xe7, 0x19, 0xcf, 0xd3, 0xd0, 0xe1, 0x74, 0x25,
+  0xd3, 0xf2, 0x27, 0x76, 0x17, 0x96, 0x5a, 0x0d, 0x33, 0x76, 0x17, 0xa1,
+  0x80, 0x5a, 0xdd, 0x5b, 0x39, 0x09, 0x81, 0x25, 0xe0, 0x55, 0x09, 0x06,
+  0xb9, 0xb2, 0x60, 0x21, 0x13, 0x09, 0x9c, 0xff, 0xf8, 0xcb, 0xbb, 0x73,
+  0x09, 0x9e, 0x26, 0x50, 0x4c, 0x38, 0x18, 0x45, 0x31, 0x04, 0x2c, 0x07,
+  0x91, 0x83, 0x28, 0x5e, 0xd1, 0x22, 0x6c, 0x74, 0xb6, 0x8e, 0x6a, 0xa0,
+  0xfa, 0xda, 0x0a, 0xe0, 0xd6, 0x71, 0x92, 0x51, 0x75, 0x0e, 0x48, 0x6f,
+  0x74, 0x38, 0x8e, 0x62, 0x2d, 0xdd, 0x65, 0x26, 0xaf, 0x22, 0x8f, 0x1c,
+  0xfd, 0x41, 0xc5, 0x39, 0x13, 0x4b, 0x9d, 0x91, 0xd9, 0x8c, 0x8c, 0x23,
+  0xa2, 0x98, 0xae, 0x94, 0x20, 0xc1, 0x78, 0x1c, 0x1c, 0x20, 0x9c, 0x78,
+  0x84, 0x01, 0x79, 0x4e, 0x94, 0x47, 0xeb, 0x36, 0xea, 0xa5, 0x87, 0x28,
+  0xfe, 0x37, 0xc4, 0x2b, 0x4a, 0x0e, 0x2b, 0x0f, 0xf0, 0x1f, 0x1c, 0x22,
+  0xc9, 0xc0, 0xd8, 0xb5, 0xe0, 0x35, 0x52, 0xe0, 0xf6, 0xdd, 0x3b, 0x28,
+  0xa6, 0xa3, 0xc5, 0x42, 0xc9, 0x84, 0x95, 0x65, 0xeb, 0x25, 0x28, 0x14,
+  0x8b, 0x35, 0x64, 0x26, 0xa6, 0x51, 0xa8, 0x26, 0x38, 0xff, 0xfe, 0x9b,
+  0xf4, 0xd7, 0x21, 0xbe, 0x77, 0xac, 0x62, 0x20, 0xd5, 0x68, 0xd6, 0xef,
+  0x96, 0x61, 0xb0, 0x51, 0x52, 0x2c, 0x89, 0x25, 0x0c, 0x5a, 0x6d, 0x59,
+  0xa9, 0x6c, 0x22, 0x7a, 0xf0, 0xf8, 0x27, 0x5a, 0xe5, 0xff, 0x64, 0xf7,
+  0x00, 0x43, 0x8e, 0x8f, 0x49, 0x46, 0x45, 0x0a, 0xd1, 0xfe, 0xfb, 0xa7,
+  0x81, 0x6f, 0x92, 0x52, 0xcb, 0xe2, 0x72, 0xcd, 0xf3, 0x73, 0xa0, 0xfd,
+  0xb4, 0xd3, 0xe3, 0xeb, 0x1f, 0x16, 0x43, 0x0e, 0x5c, 0x83, 0xd5, 0x2f,
+  0xd8, 0x82, 0x56, 0xb9, 0x0e, 0xa3, 0x93, 0xce, 0xbe, 0xd3, 0xcd, 0xd1,
+  0xef, 0x9f, 0x8e, 0xda, 0x8d, 0x87, 0x21, 0x28, 0x35, 0x67, 0x54, 0xed,
+  0xe4, 0xd1, 0x67, 0xe1, 0x02, 0x53, 0x81, 0xf3, 0xae, 0xd9, 0x25, 0xf2,
+  0x7a, 0xcf, 0x4b, 0x28, 0xe5, 0x4c, 0x85, 0xc1, 0x9c, 0x2d, 0xa4, 0x62,
+  0x95, 0xc8, 0x25, 0x4d, 0xc1, 0xd5, 0x3b, 0x72, 0x0f, 0xc9, 0x82, 0x42,
+  0xb4, 0x7b, 0x02, 0x3d, 0xb4, 0x8f, 0x10, 0xa4, 0x37, 0x7c, 0xc5, 0x20,
+  0x1c, 0xc2, 0xae, 0x24, 0x43, 0x32, 0x19, 0x8f, 0xc7, 0xde, 0x21, 0xc7,
+  0x1e, 0xaa, 0xcc, 0x37, 0xf3, 0x7e, 0xa8, 0x43, 0x16, 0xae, 0xc9, 0x62,
+  0xf8, 0xbd, 0x6d, 0x0e, 0xf2, 0xec, 0x19, 0x12, 0x74, 0x5d, 0xf6, 0xaf,
+  0x8e, 0x51, 0x12, 0x9b, 0x1b, 0x90, 0xaa, 0x13, 0x2c, 0xe4, 0x19, 0x09,
+  0xc7, 0x77, 0xdf, 0x8d, 0x47, 0x93, 0xd6, 0xf8, 0x96, 0x97, 0x8d, 0xa1,
+  0x78, 0xa1, 0xe4, 0xea, 0xdc, 0x9d, 0x08, 0x13, 0x13, 0xed, 0xad, 0x54,
+  0xe0, 0x03, 0x56, 0x10, 0x38, 0x72, 0x6e, 0x38, 0xcc, 0xc8, 0x6b, 0xeb,
+  0x7b, 0x35, 0x17, 0xb3, 0x14, 0x39, 0xcc, 0xe0, 0x2d, 0x94, 0x7b, 0x53,
+  0xfe, 0x02, 0x3c, 0xbb, 0x02, 0x15, 0x10, 0xf0, 0x21, 0x25, 0x79, 0x1a,
+  0xc7, 0x7b, 0x11, 0x5f, 0xbe, 0xda, 0x86, 0x7c, 0xf9, 0xaa, 0xc1, 0xbc,
+  0x00, 0xe7, 0xd6, 0xcc, 0x06, 0x70, 0xb9, 0xe1, 0x10, 0x6e, 0x04, 0x33,
+  0x93, 0xaf, 0x81, 0x84, 0x42, 0xe2, 0x0e, 0x2e, 0xb1, 0x8e, 0x06, 0xd3,
+  0x8e, 0x7f, 0x38, 0x8c, 0x5f, 0x55, 0xd0, 0x75, 0xbd, 0x39, 0xe4, 0xce,
+  0xdb, 0x93, 0x1e, 0xc0, 0x0d, 0x9d, 0xef, 0x39, 0xae, 0x1f, 0x73, 0xfc,
+  0x9c, 0x16, 0xe5, 0x7b, 0x68, 0x3d, 0x7a, 0x18, 0x7e, 0xac, 0x79, 0xc2,
+  0x9a, 0x0c, 0xb9, 0x87, 0xdd, 0xdd, 0x64, 0x1e, 0x7c, 0x99, 0xdf, 0x75,
+  0xc6, 0x17, 0xda, 0x43, 0x70, 0x52, 0x40, 0x7f, 0xa2, 0x64, 0xfe, 0x28,
+  0x21, 0x5a, 0x73, 0xed, 0x91, 0xe3, 0xfb, 0xc5, 0x23, 0xe4, 0x78, 0xa3,
+  0x94, 0xdc, 0x7c, 0x2c, 0xf6, 0xdf, 0xe5, 0xf3, 0x9b, 0xc7, 0xa2, 0x5c,
+  0xc8, 0x8d, 0x38, 0x80, 0xf3, 0x76, 0x07, 0xce, 0x2e, 0x98, 0xf7, 0xac,
+  0xa3, 0x98, 0x3e, 0xcc, 0xc5, 0x63, 0xc5, 0xf9, 0x85, 0x2f, 0xb3, 0x43,
+  0x40, 0xe7, 0x7b, 0x81, 0x6c, 0xfc, 0x94, 0x50, 0x4a, 0xff, 0x80, 0x03,
+  0xc6, 0x5f, 0x07, 0x5e, 0xca, 0x33, 0x09, 0xc0, 0x34, 0x0f, 0x10, 0x10,
+  0x10, 0xe1, 0x25, 0x59, 0x4a, 0xd3, 0x27, 0x12, 0x4a, 0x4a, 0x08, 0x4b,
+  0xc8, 0xba, 0x9f, 0xd8, 0xfc, 0x1a, 0x9c, 0x89, 0xe9, 0x21, 0xa1, 0x25,
+  0x51, 0x74, 0x43, 0x3e, 0xde, 0xfc, 0x30, 0x7a, 0x6d, 0x1a, 0xa5, 0x4d,
+  0x09, 0x22, 0x88, 0x2a, 0xcf, 0xcd, 0xdb, 0x9f, 0x15, 0xab, 0x18, 0xf6,
+  0x4c, 0x50, 0x74, 0xda, 0x0a, 0x03, 0x23, 0x8d, 0x60, 0x89, 0x6e, 0x32,
+  0xa6, 0x3d, 0xc3, 0x36, 0x2d, 0x30, 0x54, 0x87, 0x72, 0x7a, 0x7c, 0x8c,
+  0x25, 0xaf, 0xd3, 0xee, 0x3c, 0x27, 0xc1, 0xb4, 0x5e, 0xc4, 0x12, 0xd4,
+  0x2e, 0x1f, 0xbb, 0x12, 0xb2, 0x29, 0xa1, 0xe3, 0x91, 0xd0, 0x28, 0xec,
+  0x4b, 0xcd, 0x18, 0xe3, 0x56, 0xac, 0x3a, 0x69, 0x9d, 0x61, 0x3d, 0xee,
+  0xe5, 0xee, 0x32, 0x46, 0x05, 0x39, 0xc2, 0xa8, 0xb3, 0xe7, 0xdf, 0xa9,
+  0xc9, 0xd0, 0x9e, 0x66, 0x8d, 0x04, 0x49, 0x2e, 0x4b, 0xb6, 0x4f, 0x04,
+  0x53, 0xfe, 0x60, 0x34, 0x70, 0x7a, 0x60, 0xa9, 0x57, 0xfe, 0x5a, 0xfd,
+  0x59, 0x44, 0xb0, 0x83, 0xd3, 0x00, 0x80, 0x42, 0xd5, 0x5b, 0x22, 0x6a,
+  0x73, 0x7d, 0x6f, 0x6d, 0x8b, 0x13, 0x5e, 0x74, 0x53, 0x46, 0x28, 0x8f,
+  0x91, 0x26, 0xec, 0x36, 0x4b, 0x05, 0xf4, 0x89, 0x8d, 0x03, 0x78, 0xdd,
+  0x1c, 0xf6, 0x8f, 0x64, 0xd6, 0x51, 0x7b, 0xb3, 0xe7, 0x5a, 0xf2, 0xae,
+  0xf6, 0xed, 0xe8, 0xc1, 0xb0, 0xd7, 0x08, 0x32, 0xad, 0x0b, 0x67, 0x37,
+  0x83, 0x53, 0xdb, 0xcb, 0x1c, 0x34, 0x56, 0x1a, 0x7a, 0x7a, 0x80, 0x79,
+  0x37, 0x93, 0x30, 0x1a, 0x06, 0x57, 0x1f, 0xae, 0x6f, 0x82, 0x61, 0xb3,
+  0x3e, 0x97, 0x29, 0x0c, 0x30, 0xb6, 0x9b, 0x6b, 0xdc, 0x13, 0xfa, 0x1b,
+  0x9d, 0x31, 0x11, 0x2a, 0x06, 0x1a, 0x3a, 0xf3, 0x50, 0xea, 0x3e, 0x88,
+  0x95, 0xb1, 0x86, 0x86, 0x32, 0xec, 0x92, 0x6b, 0xd3, 0x63, 0xd6, 0xf4,
+  0xb0, 0xea, 0xba, 0xa2, 0x2e, 0x06, 0x5a, 0xa4, 0x2e, 0x2f, 0x5d, 0x35,
+  0x75, 0xe2, 0xa4, 0x69, 0x9b, 0x97, 0x61, 0x2b, 0x5d, 0xd4, 0x68, 0xfb,
+  0x89, 0xab, 0xb9, 0x8d, 0x1b, 0xfb, 0x46, 0xef, 0xe8, 0xdb, 0x72, 0xb2,
+  0x5d, 0xbd, 0xb5, 0x13, 0x16, 0x52, 0xb0, 0x14, 0x84, 0x69, 0x7a, 0x7f,
+  0xad, 0xa1, 0x79, 0xc6, 0x52, 0xd3, 0x00, 0xc5, 0x1f, 0xae, 0x2e, 0xff,
+  0xe5, 0xa3, 0xd5, 0x0e, 0xda, 0x07, 0x6b, 0x29, 0x20, 0x7a, 0x41, 0x57,
+  0x91, 0xf3, 0xb1, 0x21, 0x16, 0x3b, 0x73, 0x19, 0x02, 0x3e, 0xc3, 0x08,
+  0x46, 0xc8, 0xa0, 0xe7, 0xd1, 0xcf, 0x4d, 0x91, 0xee, 0x04, 0xca, 0x13,
+  0x74, 0xa0, 0x26, 0x5c, 0x5b, 0x97, 0x04, 0xf0, 0x2b, 0x0a, 0x0d, 0x85,
+  0x49, 0x0e, 0x5c, 0x10, 0x9c, 0xe2, 0x31, 0x0f, 0x54, 0x05, 0x76, 0x15,
+  0x43, 0x48, 0x37, 0x14, 0xc5, 0x06, 0xd0, 0x0d, 0x18, 0x81, 0x80, 0x25,
+  0x08, 0x74, 0xef, 0x39, 0xb7, 0x33, 0x0a, 0x64, 0x8d, 0x5b, 0xd8, 0x82,
+  0x36, 0x04, 0x76, 0xa8, 0xf6, 0x7c, 0x12, 0x31, 0x8d, 0xc9, 0x7c, 0x55,
+  0x07, 0x66, 0x99, 0xa0, 0x1f, 0xe1, 0x96, 0x0b, 0xdb, 0x68, 0x8f, 0xdf,
+  0x3d, 0x36, 0x5f, 0x18, 0xd0, 0x47, 0xb9, 0x63, 0x06, 0x36, 0x61, 0xaa,
+  0x9c, 0x42, 0xe7, 0x69, 0x4a, 0x18, 0x74, 0x53, 0xa3, 0x9b, 0x7b, 0xac,
+  0x90, 0x24, 0xf0, 0x6e, 0x75, 0x2c, 0x21, 0x94, 0xf5, 0x08, 0xa6, 0x08,
+  0x46, 0x57, 0x01, 0x34, 0x8b, 0x3d, 0x7f, 0xc6, 0x04, 0xf7, 0x36, 0x97,
+  0xf3, 0xf0, 0x33, 0xde, 0xe2, 0xb7, 0xe8, 0xeb, 0x1c, 0x12, 0x34, 0x7e,
+  0x0d, 0xfd, 0x5e, 0x92, 0x81, 0xce, 0x51, 0x9d, 0x30, 0x85, 0xcb, 0x3c,
+  0xc7, 0x6f, 0x18, 0x43, 0xf3, 0x0e, 0xfd, 0xc5, 0x8a, 0x0b, 0x9a, 0x93,
+  0x32, 0x93, 0x1b, 0x4b, 0x02, 0x0c, 0x19, 0xc4, 0xe0, 0x0a, 0xf1, 0x87,
+  0xc4, 0x28, 0x9b, 0x19, 0x4b, 0x25, 0x20, 0x32, 0x1a, 0x80, 0x5b, 0xcb,
+  0xe4, 0xd0, 0x1a, 0xc6, 0xc8, 0xe0, 0x8d, 0x20, 0xa0, 0x26, 0x7d, 0x0f,
+  0x7e, 0x82, 0x9c, 0xc0, 0xb6, 0xc0, 0x0c, 0x59, 0x40, 0x2c, 0x3a, 0xca,
+  0xb5, 0xe1, 0xcc, 0x98, 0x88, 0x5b, 0xab, 0x61, 0x77, 0x1f, 0xe2, 0xe7,
+  0x0d, 0x3f, 0x8d, 0x54, 0x2a, 0xc7, 0x14, 0xf9, 0x0d, 0x86, 0xb1, 0xcc,
+  0xff, 0xf1, 0xe7, 0xcc, 0xec, 0x6f, 0x8f, 0x69, 0xf5, 0x40, 0x51, 0xcf,
+  0xa6, 0xb5, 0xaf, 0xa2, 0x04, 0xe4, 0xc9, 0x0c, 0x67, 0xbc, 0x94, 0x01,
+  0x01, 0xe4, 0x6d, 0x23, 0x05, 0xb8, 0x75, 0xf0, 0x0c, 0x37, 0x0d, 0x20,
+  0x3e, 0x78, 0x9e, 0x03, 0x04, 0xff, 0x8f, 0xbc, 0x52, 0x8f, 0xa9, 0xe6,
+  0x0b, 0x80, 0x1d, 0x6e, 0x7f, 0xba, 0xf9, 0xf9, 0x7d, 0xb7, 0x48, 0x18,
+  0xe7, 0x75, 0xe3, 0xe5, 0xaf, 0x02, 0x06, 0x4c, 0x08, 0x80, 0x4b, 0x0a,
+  0x42, 0x34, 0x9a, 0x0c, 0x8d, 0xad, 0xfa, 0xc5, 0x08, 0xd5, 0xa9, 0xe9,
+  0x1c, 0xc0, 0xcc, 0x36, 0xc0, 0xa7, 0xec, 0xee, 0xc3, 0x22, 0xc4, 0xde,
+  0xaf, 0x5b, 0x9a, 0x50, 0x0d, 0x48, 0x79, 0xda, 0x4e, 0x98, 0x5b, 0x48,
+  0x5f, 0x18, 0xd5, 0x53, 0xbe, 0xee, 0x81, 0x6e, 0xcd, 0xeb, 0x56, 0x8a,
+  0xb2, 0x9a, 0x97, 0x76, 0xd6, 0x45, 0x8e, 0xcf, 0xc9, 0x64, 0xc7, 0x29,
+  0xac, 0x83, 0xe0, 0x6a, 0x5e, 0x75, 0x22, 0x58, 0x9e, 0xac, 0xc7, 0xf4,
+  0x61, 0xc6, 0x43, 0xbc, 0x65, 0x14, 0xb9, 0x32, 0xba, 0xad, 0x56, 0x7f,
+  0xfe, 0x17, 0xcd, 0x38, 0xe0, 0x42, 0xe4, 0xab, 0x82, 0xe9, 0xe0, 0x17,
+  0x9f, 0xb9, 0x46, 0xdb, 0x1c, 0x14, 0x1d, 0x65, 0x6c, 0xdc, 0x50, 0x0a,
+  0xc8, 0x9a, 0x90, 0xf6, 0x45, 0x87, 0xb6, 0x37, 0x3d, 0x9b, 0xd6, 0x6c,
+  0x56, 0x0f, 0x02, 0x91, 0x83, 0xb1, 0x9f, 0x37, 0x62, 0x1c, 0xc1, 0xae,
+  0x94, 0x2c, 0xe8, 0x92, 0xda, 0x0a, 0xde, 0x91, 0x51, 0x0a, 0x9b, 0xff,
+  0x0e, 0xa0, 0xff, 0xef, 0xb3, 0xb9, 0xdf, 0x84, 0xdb, 0x2c, 0x0c, 0x43,
+  0x4f, 0xce, 0x8b, 0xb9, 0xa4, 0x2a, 0xbd, 0xa0, 0x9a, 0xa2, 0xaa, 0xf0,
+  0x77, 0x18, 0xa0, 0x1b, 0x07, 0x51, 0x2d, 0x7b, 0x7f, 0x8c, 0xee, 0x89,
+  0xfe, 0x15, 0xaa, 0xb9, 0xb2, 0xdf, 0x1d, 0x82, 0xa8, 0x5b, 0xc4, 0x9a,
+  0x21, 0xcd, 0x8d, 0x69, 0xb5, 0x1f, 0xe7, 0x20, 0xe5, 0x49, 0xb7, 0xa5,
+  0xfa, 0x51, 0x6a, 0xe2, 0x50, 0x80, 0xda, 0x73, 0xe3, 0xf6, 0xfb, 0xa0,
+  0x15, 0xa9, 0x2a, 0x76, 0x0b, 0xe4, 0xc7, 0xd1, 0x67, 0x67, 0xab, 0xa1,
+  0x3f, 0x8b, 0x0c, 0x9b, 0x99, 0x0f, 0x9e, 0x48, 0xf0, 0x5b, 0x13, 0x8b,
+  0xe6, 0x1a, 0x11, 0xa4, 0x1f, 0x32, 0x9a, 0xf4, 0xd1, 0xdc, 0x45, 0x18,
+  0xc2, 0xc1, 0xbc, 0x8d, 0x40, 0x04, 0x92, 0x8f, 0x77, 0x1f, 0x9f, 0xef,
+  0x2e, 0x85, 0x38, 0xeb, 0x74, 0xd5, 0xb1, 0x75, 0xda, 0xe8, 0xc0, 0xdd,
+  0xaf, 0x17, 0xc3, 0x66, 0x9b, 0xda, 0xc6, 0x2e, 0xde, 0x64, 0x3c, 0xc9,
+  0x4e, 0xb6, 0xf6, 0xdb, 0xef, 0x3e, 0x9d, 0xad, 0x87, 0xc1, 0xf6, 0x53,
+  0xa3, 0x3a, 0xf7, 0x71, 0x71, 0x5b, 0x83, 0x20, 0x69, 0x01, 0x51, 0x0d,
+  0x01, 0x0d, 0xf3, 0x02, 0x48, 0x54, 0x0e, 0x76, 0x48, 0x6a, 0xce, 0xee,
+  0x48, 0x61, 0x9e, 0xb9, 0x4c, 0x8e, 0xf7, 0x1a, 0x75, 0x6c, 0x93, 0xfa,
+  0xdb, 0xa8, 0x75, 0x30, 0xc6, 0x2e, 0xb5, 0x37, 0xdd, 0x5b, 0xff, 0xcc,
+  0xbe, 0x3b, 0x36, 0xe9, 0x22, 0x4e, 0xc1, 0xd9, 0x6f, 0x14, 0x15, 0xe5,
+  0x82, 0xa9, 0x68, 0xc7, 0xbe, 0x11, 0x1e, 0xdb, 0x80, 0x68, 0x2b, 0x5d,
+  0x35, 0xae, 0x56, 0x7f, 0x79, 0x6d, 0xfa, 0xf9, 0x1d, 0x54, 0xf5, 0x77,
+  0xdc, 0x20, 0xf8, 0x32, 0x8e, 0x7b, 0xfa, 0x96, 0x2f, 0x59, 0x6e, 0xac,
+  0xdb, 0xbe, 0xf1, 0xa3, 0x18, 0xed, 0x8c, 0xe8, 0x76, 0x4a, 0xe9, 0xf7,
+  0x9e, 0x3d, 0x57, 0x7a, 0xb0, 0x7f, 0x40, 0x70, 0x7f, 0x37, 0xf8, 0x2f,
+  0x9f, 0x1d, 0xcf, 0x77, 0xe7, 0x1a, 0x00, 0x00
 };
-unsigned int src_kbsend_html_len = 4260;
+unsigned int src_kbsend_html_gz_len = 2324;
+#define KBSEND_ETAG "\"3896270086\""
@@ -1,11 +1,121 @@
 #pragma once
 
+#include <algorithm>
 #include <deque>
+#include <string>
 #include <vector>
+#include <errno.h>
+#include <string.h>
+#include <sys/uio.h>
+
+// Fixed size byte ring, used to move bytes between the pty and the rest of inkvt
+// in large contiguous spans instead of one byte at a time.
+// The capacity must be a power of two.
+class RingBuffer {
+    std::vector<char> data;
+    size_t mask;
+    size_t head = 0; // read position
+    size_t tail = 0; // write position
+public:
+    struct Span {
+        char * data;
+        size_t size;
+    };
+
+    explicit RingBuffer(size_t capacity) : data(capacity), mask(capacity - 1) {}
+
+    size_t capacity() const { return data.size(); }
+    size_t size() const { return tail - head; }
+    size_t space() const { return capacity() - size(); }
+    bool empty() const { return head == tail; }
+
+    // Contiguous free space at the write position, fill it and then commit()
+    Span write_span() {
+        if (empty()) {
+            // Rewind, so a drained buffer always offers its full capacity
+            head = tail = 0;
+        }
+        size_t offset = tail & mask;
+        size_t n = std::min(space(), capacity() - offset);
+        return { &data[offset], n };
+    }
+
+    void commit(size_t n) {
+        tail += n;
+    }
+
+    // Contiguous readable bytes at the read position, use them and then consume()
+    Span read_span() {
+        size_t offset = head & mask;
+        size_t n = std::min(size(), capacity() - offset);
+        return { &data[offset], n };
+    }
+
+    void consume(size_t n) {
+        head += n;
+    }
+
+    // Copies as much of buf as fits, returns the number of bytes copied
+    size_t write(const char * buf, size_t len) {
+        size_t written = 0;
+        while (written < len) {
+            Span span = write_span();
+            if (span.size == 0) break;
+            size_t n = std::min(span.size, len - written);
+            memcpy(span.data, buf + written, n);
+            commit(n);
+            written += n;
+        }
+        return written;
+    }
+
+    // Fills the free space with read(dst, n), which returns how much it wrote to dst (at most n).
+    // Stops when read() comes up short, returns the total.
+    template <typename F>
+    size_t fill(F read) {
+        size_t total = 0;
+        for (;;) {
+            Span span = write_span();
+            if (span.size == 0) break;
+            size_t n = read(span.data, span.size);
+            commit(n);
+            total += n;
+            if (n < span.size) break;
+        }
+        return total;
+    }
+
+    // writev() as much as fd takes, both halves at once when the data wraps around.
+    // Returns false on errors other than EAGAIN.
+    bool write_to(int fd) {
+        while (!empty()) {
+            size_t offset = head & mask;
+            size_t first = std::min(size(), capacity() - offset);
+            iovec iov[2] = {
+                { &data[offset], first },
+                { &data[0], size() - first },
+            };
+            ssize_t nwritten = writev(fd, iov, first < size() ? 2 : 1);
+            if (nwritten < 0) {
+                if (errno == EINTR) continue;
+                return errno == EAGAIN;
+            }
+            consume(static_cast<size_t>(nwritten));
+        }
+        return true;
+    }
+};
+
+// pty reads are done straight into vt100_in, so this bounds the read() size
+constexpr size_t VT100_IN_CAPACITY = 64u * 1024u;
+// keyboard input the shell didn't read yet, beyond that it waits in Buffers::keyboard
+constexpr size_t PTY_OUT_CAPACITY = 16u * 1024u;
 
 struct Buffers {
     std::deque<int> scancodes;
-    std::deque<char> serial;
     std::deque<char> keyboard;
-    std::deque<char> vt100_in;
+    RingBuffer vt100_in { VT100_IN_CAPACITY };
+    RingBuffer pty_out { PTY_OUT_CAPACITY };
+    // input that went straight to pty_out (serial input, pastes) since the main loop last looked
+    std::string typed_direct;
 };
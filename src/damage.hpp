@@ -0,0 +1,150 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../libvterm/include/vterm.h"
+
+// Cells that changed since the last frame: a bitmap of dirty rows,
+// plus the span of dirty columns in each of them.
+class DamageTracker {
+    std::vector<uint64_t> bits;
+    std::vector<int> start_col;
+    std::vector<int> end_col;
+    int nrows = 0;
+    int ncols = 0;
+    int ndirty = 0;
+
+    void mark(int row, int col0, int col1) {
+        uint64_t bit = 1ull << (row & 63);
+        uint64_t & word = bits[static_cast<size_t>(row >> 6)];
+        size_t r = static_cast<size_t>(row);
+        if (word & bit) {
+            start_col[r] = std::min(start_col[r], col0);
+            end_col[r] = std::max(end_col[r], col1);
+        } else {
+            word |= bit;
+            start_col[r] = col0;
+            end_col[r] = col1;
+            ndirty += 1;
+        }
+    }
+
+    void unmark(int row) {
+        uint64_t bit = 1ull << (row & 63);
+        uint64_t & word = bits[static_cast<size_t>(row >> 6)];
+        if (word & bit) {
+            word &= ~bit;
+            ndirty -= 1;
+        }
+    }
+
+public:
+    void resize(int rows, int cols) {
+        nrows = rows;
+        ncols = cols;
+        bits.assign(static_cast<size_t>((rows + 63) / 64), 0u);
+        start_col.assign(static_cast<size_t>(rows), 0);
+        end_col.assign(static_cast<size_t>(rows), 0);
+        ndirty = 0;
+    }
+
+    bool empty() const {
+        return ndirty == 0;
+    }
+
+    bool is_dirty(int row) const {
+        return (bits[static_cast<size_t>(row >> 6)] >> (row & 63)) & 1u;
+    }
+
+    void add(const VTermRect & rect) {
+        int row0 = std::max(rect.start_row, 0);
+        int row1 = std::min(rect.end_row, nrows);
+        int col0 = std::max(rect.start_col, 0);
+        int col1 = std::min(rect.end_col, ncols);
+        if (col0 >= col1) return;
+        for (int row = row0; row < row1; row++) {
+            mark(row, col0, col1);
+        }
+    }
+
+    void add(const VTermPos & pos) {
+        add({ pos.row, pos.row + 1, pos.col, pos.col + 1 });
+    }
+
+    void add_all() {
+        add({ 0, nrows, 0, ncols });
+    }
+
+    int count(int row0, int row1) const {
+        int n = 0;
+        for (int row = std::max(row0, 0); row < std::min(row1, nrows); row++) {
+            n += is_dirty(row);
+        }
+        return n;
+    }
+
+    // The pixels of src were moved to dst: so is whatever was still waiting to be drawn there
+    void move(const VTermRect & dst, const VTermRect & src) {
+        int dcol = dst.start_col - src.start_col;
+        bool full_width = dst.start_col <= 0 && dst.end_col >= ncols;
+        int nmoved = dst.end_row - dst.start_row;
+        // Walk in the same order as the pixels were moved, so src rows are read before being overwritten
+        bool upwards = dst.start_row <= src.start_row;
+        for (int i = 0; i < nmoved; i++) {
+            int k = upwards ? i : nmoved - 1 - i;
+            int s = src.start_row + k;
+            int d = dst.start_row + k;
+            if (s < 0 || s >= nrows || d < 0 || d >= nrows) continue;
+            bool src_dirty = is_dirty(s);
+            int col0 = start_col[static_cast<size_t>(s)];
+            int col1 = end_col[static_cast<size_t>(s)];
+            if (full_width) {
+                // The destination row now holds exactly the source row
+                unmark(d);
+            }
+            int dcol0 = std::max(col0 + dcol, dst.start_col);
+            int dcol1 = std::min(col1 + dcol, dst.end_col);
+            if (src_dirty && dcol0 < dcol1) {
+                mark(d, dcol0, dcol1);
+            }
+        }
+    }
+
+    // f(row, start_col, end_col) for every dirty row, top to bottom
+    template <typename F>
+    void for_each(F f) const {
+        for (size_t w = 0u; w < bits.size(); w++) {
+            uint64_t word = bits[w];
+            while (word) {
+                int row = static_cast<int>(w * 64u) + __builtin_ctzll(word);
+                word &= word - 1u;
+                f(row, start_col[static_cast<size_t>(row)], end_col[static_cast<size_t>(row)]);
+            }
+        }
+    }
+
+    void clear() {
+        std::fill(bits.begin(), bits.end(), 0u);
+        ndirty = 0;
+    }
+};
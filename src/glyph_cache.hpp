@@ -0,0 +1,119 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <unordered_map>
+#include <vector>
+
+// Everything that changes the pixels of a single terminal cell
+struct GlyphKey {
+    uint32_t codepoint;
+    uint32_t fg; // 0xRRGGBB, after the FG()/BG() e-ink transform
+    uint32_t bg;
+    uint8_t attrs; // GLYPH_BOLD | GLYPH_ITALIC
+
+    bool operator==(const GlyphKey & other) const {
+        return codepoint == other.codepoint && fg == other.fg && bg == other.bg && attrs == other.attrs;
+    }
+};
+
+constexpr uint8_t GLYPH_BOLD = 1u << 0;
+constexpr uint8_t GLYPH_ITALIC = 1u << 1;
+// Codepoint of a key that matches nothing: pixels we can't describe with a GlyphKey
+constexpr uint32_t GLYPH_UNKNOWN = 0xFFFFFFFFu;
+
+struct GlyphKeyHash {
+    size_t operator()(const GlyphKey & k) const {
+        uint64_t h = k.codepoint;
+        h = h * 0x9E3779B97F4A7C15ull ^ k.fg;
+        h = h * 0x9E3779B97F4A7C15ull ^ k.bg;
+        h = h * 0x9E3779B97F4A7C15ull ^ k.attrs;
+        return static_cast<size_t>(h ^ (h >> 29));
+    }
+};
+
+// Atlas of already rasterized cells, stored in framebuffer pixel format,
+// so a cache hit is glyph_height row memcpy()s straight into the framebuffer.
+// Cells are rasterized once by FBInk and captured from the framebuffer.
+class GlyphCache {
+    std::unordered_map<GlyphKey, size_t, GlyphKeyHash> slots;
+    std::vector<uint8_t> pixels;
+    size_t max_slots = 0;
+public:
+    unsigned int width = 0u;  // pixels
+    unsigned int height = 0u; // pixels
+    unsigned int bytes_per_pixel = 0u;
+    // Upper bound for the atlas, the whole thing is dropped when full
+    size_t max_bytes = 4u * 1024u * 1024u;
+
+    size_t row_bytes() const {
+        return width * bytes_per_pixel;
+    }
+
+    size_t glyph_bytes() const {
+        return row_bytes() * height;
+    }
+
+    void reset(unsigned int glyph_width, unsigned int glyph_height, unsigned int bpp) {
+        width = glyph_width;
+        height = glyph_height;
+        bytes_per_pixel = bpp;
+        clear();
+        max_slots = glyph_bytes() > 0u ? max_bytes / glyph_bytes() : 0u;
+    }
+
+    void clear() {
+        slots.clear();
+        pixels.clear();
+    }
+
+    size_t size() const {
+        return slots.size();
+    }
+
+    // Copy the cached glyph to dst, returns false on a miss
+    bool blit(const GlyphKey & key, uint8_t * dst, size_t dst_stride) const {
+        auto it = slots.find(key);
+        if (it == slots.end()) return false;
+        const uint8_t * src = &pixels[it->second * glyph_bytes()];
+        size_t n = row_bytes();
+        for (unsigned int y = 0u; y < height; y++) {
+            memcpy(dst + y * dst_stride, src + y * n, n);
+        }
+        return true;
+    }
+
+    // Store the cell that was just rasterized at src
+    void capture(const GlyphKey & key, const uint8_t * src, size_t src_stride) {
+        if (max_slots == 0u) return;
+        if (slots.size() >= max_slots) {
+            clear();
+        }
+        size_t slot = slots.size();
+        slots.emplace(key, slot);
+        pixels.resize((slot + 1u) * glyph_bytes());
+        uint8_t * dst = &pixels[slot * glyph_bytes()];
+        size_t n = row_bytes();
+        for (unsigned int y = 0u; y < height; y++) {
+            memcpy(dst + y * n, src + y * src_stride, n);
+        }
+    }
+};
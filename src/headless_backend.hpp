@@ -0,0 +1,195 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include "./render_backend.hpp"
+// for topaz_block1
+#include "./rounded_rect.hpp"
+
+// In-memory 8bpp grayscale display, to run and profile the draw path without a framebuffer.
+// Text is always drawn in topaz (8x16, ASCII only) scaled by the fontmult, whatever font was asked for.
+class HeadlessBackend : public RenderBackend {
+    static constexpr unsigned int FONT_W = 8u;
+    static constexpr unsigned int FONT_H = 16u;
+
+    std::vector<uint8_t> pixels;
+    unsigned int glyph_w = FONT_W;
+    unsigned int glyph_h = FONT_H;
+    uint8_t fontmult = 1u;
+    // counts the refreshes, like FBInk's update markers
+    uint32_t markers = 0u;
+
+    static uint8_t gray(uint32_t rgb) {
+        uint32_t r = (rgb >> 16) & 0xFFu;
+        uint32_t g = (rgb >> 8) & 0xFFu;
+        uint32_t b = rgb & 0xFFu;
+        return static_cast<uint8_t>((r * 77u + g * 151u + b * 28u) >> 8);
+    }
+
+    static uint32_t next_codepoint(const char *& s) {
+        const unsigned char * u = reinterpret_cast<const unsigned char *>(s);
+        uint32_t cp;
+        int n;
+        if (u[0] < 0x80u) { cp = u[0]; n = 1; }
+        else if ((u[0] & 0xE0u) == 0xC0u) { cp = u[0] & 0x1Fu; n = 2; }
+        else if ((u[0] & 0xF0u) == 0xE0u) { cp = u[0] & 0x0Fu; n = 3; }
+        else { cp = u[0] & 0x07u; n = 4; }
+        for (int i = 1; i < n; i++) {
+            if ((u[i] & 0xC0u) != 0x80u) { n = i; break; }
+            cp = (cp << 6) | (u[i] & 0x3Fu);
+        }
+        s += n;
+        return cp;
+    }
+
+    void fill(unsigned int x0, unsigned int y0, unsigned int w, unsigned int h, uint8_t v) {
+        for (unsigned int y = y0; y < y0 + h && y < height; y++) {
+            if (x0 >= width) break;
+            unsigned int n = std::min(w, width - x0);
+            memset(&pixels[static_cast<size_t>(y) * width + x0], v, n);
+        }
+    }
+
+    void draw_glyph(unsigned int x0, unsigned int y0, uint32_t cp, uint8_t fg, uint8_t bg) {
+        fill(x0, y0, glyph_w, glyph_h, bg);
+        if (cp < 0x20u) return;
+        const unsigned char * bitmap = topaz_block1[cp < 0x80u ? cp : '?'];
+        for (unsigned int fy = 0u; fy < FONT_H; fy++) {
+            for (unsigned int fx = 0u; fx < FONT_W; fx++) {
+                if (bitmap[fy] & (1u << fx)) {
+                    fill(x0 + fx * fontmult, y0 + fy * fontmult, fontmult, fontmult, fg);
+                }
+            }
+        }
+    }
+
+public:
+    unsigned int width;
+    unsigned int height;
+
+    HeadlessBackend(unsigned int w, unsigned int h) : pixels(static_cast<size_t>(w) * h, 0xFFu), width(w), height(h) {}
+
+    bool open(FBInkConfig * config, FBInkState * state) override {
+        fontmult = config->fontmult > 0u ? config->fontmult : 1u;
+        glyph_w = FONT_W * fontmult;
+        glyph_h = FONT_H * fontmult;
+        *state = {};
+        state->font_name = "topaz";
+        state->view_width = state->screen_width = width;
+        state->view_height = state->screen_height = height;
+        state->scanline_stride = width;
+        state->bpp = 8u;
+        snprintf(state->device_name, sizeof(state->device_name), "Headless");
+        snprintf(state->device_codename, sizeof(state->device_codename), "headless");
+        snprintf(state->device_platform, sizeof(state->device_platform), "memory");
+        state->pen_fg_color = 0x00u;
+        state->pen_bg_color = 0xFFu;
+        state->font_w = static_cast<unsigned short int>(FONT_W);
+        state->font_h = static_cast<unsigned short int>(FONT_H);
+        state->fontsize_mult = fontmult;
+        state->glyph_width = static_cast<uint8_t>(glyph_w);
+        state->glyph_height = static_cast<uint8_t>(glyph_h);
+        state->max_cols = static_cast<unsigned short int>(width / glyph_w);
+        state->max_rows = static_cast<unsigned short int>(height / glyph_h);
+        state->is_perfect_fit = width % glyph_w == 0u && height % glyph_h == 0u;
+        state->current_rota = FB_ROTATE_UR;
+        return state->max_cols > 0u && state->max_rows > 0u;
+    }
+
+    int reinit(FBInkConfig * config __attribute__((unused)), FBInkState * state __attribute__((unused))) override {
+        return EXIT_SUCCESS;
+    }
+
+    uint8_t * framebuffer(size_t * size) override {
+        *size = pixels.size();
+        return pixels.data();
+    }
+
+    void cls(const FBInkConfig * config __attribute__((unused))) override {
+        memset(pixels.data(), 0xFF, pixels.size());
+        markers += 1u;
+    }
+
+    void print(const char * text, uint32_t fg, uint32_t bg, const FBInkConfig * config) override {
+        unsigned int x = static_cast<unsigned int>(config->col) * glyph_w;
+        unsigned int y = static_cast<unsigned int>(config->row) * glyph_h;
+        while (*text) {
+            draw_glyph(x, y, next_codepoint(text), gray(fg), gray(bg));
+            x += glyph_w;
+        }
+    }
+
+    void grid_clear(unsigned short int cols, unsigned short int rows, uint32_t bg, const FBInkConfig * config) override {
+        unsigned int x = static_cast<unsigned int>(config->col) * glyph_w;
+        unsigned int y = static_cast<unsigned int>(config->row) * glyph_h;
+        fill(x, y, cols * glyph_w, rows * glyph_h, gray(bg));
+    }
+
+    void print_raw_data(const uint8_t * data, int w, int h, size_t len, short int x, short int y, const FBInkConfig * config) override {
+        // Y, YA, RGB or RGBA: the first component is close enough to gray for our purposes
+        if (w <= 0 || h <= 0) return;
+        size_t bpp = len / (static_cast<size_t>(w) * static_cast<size_t>(h));
+        if (bpp == 0u) return;
+        long x0 = static_cast<long>(config->col) * glyph_w + x;
+        long y0 = static_cast<long>(config->row) * glyph_h + y;
+        for (long dy = 0; dy < h; dy++) {
+            long py = y0 + dy;
+            if (py < 0 || py >= static_cast<long>(height)) continue;
+            for (long dx = 0; dx < w; dx++) {
+                long px = x0 + dx;
+                if (px < 0 || px >= static_cast<long>(width)) continue;
+                pixels[static_cast<size_t>(py) * width + static_cast<size_t>(px)] = data[static_cast<size_t>(dy * w + dx) * bpp];
+            }
+        }
+    }
+
+    void grid_refresh(unsigned short int cols __attribute__((unused)), unsigned short int rows __attribute__((unused)), const FBInkConfig * config __attribute__((unused))) override {
+        markers += 1u;
+    }
+
+    void refresh(uint32_t top __attribute__((unused)), uint32_t left __attribute__((unused)), uint32_t w __attribute__((unused)), uint32_t h __attribute__((unused)), const FBInkConfig * config __attribute__((unused))) override {
+        markers += 1u;
+    }
+
+    // Updates are complete as soon as they are submitted
+    uint32_t last_marker() override {
+        return markers;
+    }
+
+    void wait_for_complete(uint32_t marker __attribute__((unused))) override {
+    }
+
+    // Binary PGM snapshot of the current contents
+    bool write_pgm(const char * path) {
+        FILE * f = fopen(path, "wb");
+        if (!f) {
+            perror("write_pgm");
+            return false;
+        }
+        fprintf(f, "P5\n%u %u\n255\n", width, height);
+        bool ok = fwrite(pixels.data(), 1, pixels.size(), f) == pixels.size();
+        fclose(f);
+        return ok;
+    }
+};
@@ -25,7 +25,7 @@
 #include <signal.h>
 #include <unistd.h>
 #include <dirent.h>
-#include <poll.h>
+#include <sys/epoll.h>
 #include <linux/input.h>
 #include <string.h>
 #include <stdio.h>
@@ -34,15 +34,24 @@
 #include <termios.h>
 #include <sys/signalfd.h>
 
+#include <unordered_map>
+
 #include "setup_serial.hpp"
 #include "buffers.hpp"
 #include "insecure_http.hpp"
 #include "vterm.hpp"
+#include "recording.hpp"
+#include "metrics.hpp"
 
 class Inputs {
 public:
     Server server;
+    InputStats serial_stats;
     bool had_input = 0;
+    // epoll_wait() returns, the fds they reported, and the time spent handling them until the next wait
+    uint64_t wakeups = 0u;
+    uint64_t wakeup_events = 0u;
+    Histogram wakeup_time;
 
     enum contact_tool {
         UNKNOWN_TOOL,
@@ -65,22 +74,21 @@ public:
         bool moved = false;
     } istate;
 private:
-    enum fdtype {
-        FD_EVDEV,
-        FD_SERIAL,
-        FD_PROGOUT,
-        FD_SERVER,
-        FD_SIGNAL,
-        FD_STDIN,
-        FD_VTERM_TIMER,
-        FD_TIMER_NO_INPUT,
-    };
-    fdtype fdtype[128];
-    struct pollfd fds[128];
-    int nfds = 0;
+    // Called with the epoll events of fd, returning false unregisters and closes fd
+    typedef bool (Inputs::*handler_t)(Buffers & buffers, int fd, uint32_t events);
+    int epfd = -1;
+    std::unordered_map<int, handler_t> handlers;
+    // the pty master, only watched for EPOLLOUT while there is keyboard input queued for it
+    int progout_fd = -1;
+    bool progout_wants_out = false;
+    int serial_fd = -1;
+    bool serial_stalled = false;
+    // when the last epoll_wait() returned
+    long woke_us = -1;
     bool should_reset_termios = 0;
     struct termios termios_reset = {};
     VTermToFBInk * vterm = 0;
+    Replay * replay = 0;
 
     bool handle_evdev(Buffers & buffers __attribute__((unused)), struct input_event * ev) {
         // NOTE: Lifted from https://github.com/NiLuJe/FBInk/blob/master/utils/finger_trace.c
@@ -183,111 +191,244 @@ private:
         return false;
     }
 
-    void handle_evdev(Buffers & buffers, int fd) {
+    // Most fds are edge-triggered: their handlers read until EAGAIN.
+    // A read of 0 or a hard error means the fd is gone (e.g., an unplugged device).
+    static bool drained(ssize_t nread) {
+        return nread < 0 && (errno == EAGAIN || errno == EINTR);
+    }
+
+    // Stamps input that arrived for vterm->trace
+    void traced(TraceSource source, size_t bytes) {
+        if (vterm) vterm->trace.arrived(source, bytes);
+    }
+
+    bool handle_evdev(Buffers & buffers, int fd, uint32_t events __attribute__((unused))) {
         struct input_event ev;
+        size_t queued = buffers.scancodes.size();
         // Drain the full input frame in one go
         for (;;) {
             ssize_t nread = read(fd, &ev, sizeof(struct input_event));
             if (nread != sizeof(struct input_event)) {
-                break;
+                traced(TRACE_EVDEV, buffers.scancodes.size() - queued);
+                return drained(nread);
             }
             handle_evdev(buffers, &ev);
         }
     }
 
-    void handle_serial(Buffers & buffers, int fd) {
-        char buf[1];
+    bool handle_serial(Buffers & buffers, int fd, uint32_t events __attribute__((unused))) {
+        // Serial input is a terminal talking to us: no key translation, read it straight into the pty queue
+        serial_stalled = false;
         for (;;) {
-            ssize_t nread = read(fd, buf, sizeof(buf));
-            if (nread == -1 || nread == 0) { // errno = EAGAIN for blocking read
-                break;
+            RingBuffer::Span span = buffers.pty_out.write_span();
+            if (span.size == 0) {
+                // The shell is behind, the rest waits in the tty until wait() sees room again
+                serial_stalled = true;
+                return true;
             }
-            for (ssize_t n = 0; n < nread; n++) {
-                buffers.serial.push_back(buf[n]);
+            ssize_t nread = read(fd, span.data, span.size);
+            if (nread <= 0) {
+                return drained(nread);
             }
+            buffers.pty_out.commit(static_cast<size_t>(nread));
+            serial_stats.add_read(static_cast<size_t>(nread));
+            traced(TRACE_SERIAL, static_cast<size_t>(nread));
+            buffers.typed_direct.append(span.data, static_cast<size_t>(nread));
+            had_input = 1;
         }
     }
 
-    void handle_progout(Buffers & buffers, int fd) {
-        char buf[64];
-        ssize_t nread = read(fd, buf, sizeof(buf));
-        if (nread < 0) return;
-        for (ssize_t i = 0; i < nread; i++) {
-            buffers.vt100_in.push_back(buf[i]);
+    bool handle_progout(Buffers & buffers, int fd, uint32_t events) {
+        if (events & EPOLLHUP) {
+            // pty slave disconnected
+            exit(0);
         }
+        if (events & EPOLLOUT) {
+            // The shell reads again, send it what main() queued up
+            if (!buffers.pty_out.write_to(fd)) {
+                perror("handle_progout:write");
+            }
+            if (buffers.pty_out.empty()) {
+                vterm->trace.written();
+            }
+        }
+        if (!(events & EPOLLIN)) {
+            return true;
+        }
+        // Read straight into the ring, main() hands it to libvterm in one go
+        RingBuffer::Span span = buffers.vt100_in.write_span();
+        if (span.size == 0) return true;
+        ssize_t nread = read(fd, span.data, span.size);
+        if (nread <= 0) return true;
+        buffers.vt100_in.commit(static_cast<size_t>(nread));
+        vterm->trace.echoed();
         // NOTE: Don't read out everything available
         // That would mean blocking in this function,
         // which disables receiving signals
-        // poll() will call us again if there is more data
+        // The pty is level-triggered, epoll_wait() will call us again if there is more data
+        return true;
+    }
+
+    bool handle_server(Buffers & buffers __attribute__((unused)), int fd __attribute__((unused)), uint32_t events __attribute__((unused))) {
+        int clientfd;
+        while ((clientfd = server.accept()) != -1) {
+            if (!watch(clientfd, EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET, &Inputs::handle_client)) {
+                close(clientfd);
+            }
+        }
+        return true;
+    }
+
+    bool handle_client(Buffers & buffers, int fd, uint32_t events __attribute__((unused))) {
+        // Keystrokes go straight to the keyboard queue, pastes to the pty, WebSocket clients stay connected
+        size_t queued = buffers.keyboard.size() + buffers.pty_out.size();
+        bool connected = server.handle(fd, buffers, vterm->term);
+        traced(TRACE_HTTP, buffers.keyboard.size() + buffers.pty_out.size() - queued);
+        return connected;
     }
 
-    void handle_server(Buffers & buffers, int fd) {
-        if (fd != server.fd) return;
-        server.accept(buffers.keyboard);
+    bool handle_replay_timer(Buffers & buffers, int fd, uint32_t events __attribute__((unused))) {
+        uint64_t buf;
+        if (read(fd, &buf, sizeof(buf)) > 0) {
+            replay->feed(buffers, *vterm);
+        }
+        return true;
+    }
+
+    bool handle_frame_timer(Buffers & buffers __attribute__((unused)), int fd, uint32_t events __attribute__((unused))) {
+        uint64_t buf;
+        if (read(fd, &buf, sizeof(buf)) > 0) {
+            vterm->render();
+        }
+        return true;
     }
 
-    void handle_vterm_timer(Buffers & buffers __attribute__((unused)), int fd) {
+    bool handle_panel(Buffers & buffers __attribute__((unused)), int fd, uint32_t events __attribute__((unused))) {
         uint64_t buf;
         if (read(fd, &buf, sizeof(buf)) > 0) {
-            vterm->tick();
+            vterm->panel_done();
         }
+        return true;
     }
 
-    void handle_signal(Buffers & buffers, int fd) {
+    bool handle_render(Buffers & buffers __attribute__((unused)), int fd, uint32_t events __attribute__((unused))) {
+        uint64_t buf;
+        if (read(fd, &buf, sizeof(buf)) > 0) {
+            vterm->render();
+        }
+        return true;
+    }
+
+    bool handle_signal(Buffers & buffers, int fd, uint32_t events __attribute__((unused))) {
         struct signalfd_siginfo fdsi;
-        ssize_t s = read(fd, &fdsi, sizeof(struct signalfd_siginfo));
-        if (s != sizeof(fdsi)) return;
-        if (fdsi.ssi_signo == SIGINT) {
-            buffers.keyboard.push_back(0x03);
-        } else {
-            printf("Got signal %u, exiting now\n", fdsi.ssi_signo);
-            exit(EXIT_SUCCESS);
+        while (read(fd, &fdsi, sizeof(struct signalfd_siginfo)) == sizeof(fdsi)) {
+            if (fdsi.ssi_signo == SIGINT) {
+                buffers.keyboard.push_back(0x03);
+            } else if (fdsi.ssi_signo == SIGUSR1) {
+                fputs(metrics().c_str(), stdout);
+                fflush(stdout);
+            } else {
+                printf("Got signal %u, exiting now\n", fdsi.ssi_signo);
+                exit(EXIT_SUCCESS);
+            }
         }
+        return true;
     }
 
-    void handle_stdin(Buffers & buffers, int fd) {
-        char c;
-        while(read(fd, &c, 1) == 1) {
-            buffers.keyboard.push_back(c);
+    bool handle_stdin(Buffers & buffers, int fd, uint32_t events __attribute__((unused))) {
+        char buf[256];
+        for (;;) {
+            ssize_t nread = read(fd, buf, sizeof(buf));
+            if (nread <= 0) {
+                return drained(nread);
+            }
+            buffers.keyboard.insert(buffers.keyboard.end(), buf, buf + nread);
+            traced(TRACE_STDIN, static_cast<size_t>(nread));
         }
     }
 
-    void handle_input_timeout(Buffers & buffers __attribute__((unused)), int fd) {
+    bool handle_input_timeout(Buffers & buffers __attribute__((unused)), int fd, uint32_t events __attribute__((unused))) {
         uint64_t buf;
         if (read(fd, &buf, sizeof(buf)) > 0 && !had_input) {
             printf("input timeout\n");
             exit(1);
         }
+        return true;
+    }
+
+    bool watch(int fd, uint32_t events, handler_t handler) {
+        if (epfd == -1) {
+            epfd = epoll_create1(EPOLL_CLOEXEC);
+            if (epfd == -1) {
+                perror("epoll_create1");
+                exit(1);
+            }
+        }
+        struct epoll_event ev = {};
+        ev.events = events;
+        ev.data.fd = fd;
+        if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+            // e.g., EPERM when stdin is a regular file
+            perror("epoll_ctl");
+            return false;
+        }
+        handlers[fd] = handler;
+        return true;
+    }
+
+    void unwatch(int fd) {
+        epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr);
+        handlers.erase(fd);
+        close(fd);
     }
 
 public:
     void wait(Buffers & buffers) {
-        poll(fds, nfds, -1);
-        for (int i = 0; i < nfds; i++) {
-            if (!fds[i].revents) {
-                continue;
-            }
-            if (fdtype[i] == FD_EVDEV) {
-                handle_evdev(buffers, fds[i].fd);
-            } else if (fdtype[i] == FD_SERIAL) {
-                handle_serial(buffers, fds[i].fd);
-            } else if (fdtype[i] == FD_PROGOUT) {
-                if (fds[i].revents & POLLHUP) {
-                    // pty slave disconnected
-                    exit(0);
-                } else {
-                    handle_progout(buffers, fds[i].fd);
+        if (woke_us != -1) {
+            wakeup_time.add(monotonic_us() - woke_us);
+        }
+        if (buffers.pty_out.empty() && buffers.keyboard.empty()) {
+            serial_stats.delivered();
+            server.stats.delivered();
+        }
+        // Pastes and serial input that filled up the pty queue carry on once the shell read some of it
+        if (buffers.pty_out.space() >= PASTE_RESUME_SPACE) {
+            for (int fd : server.stalled()) {
+                if (!handle_client(buffers, fd, 0u)) {
+                    unwatch(fd);
                 }
-            } else if (fdtype[i] == FD_SERVER) {
-                handle_server(buffers, fds[i].fd);
-            } else if (fdtype[i] == FD_SIGNAL) {
-                handle_signal(buffers, fds[i].fd);
-            } else if (fdtype[i] == FD_STDIN) {
-                handle_stdin(buffers, fds[i].fd);
-            } else if (fdtype[i] == FD_VTERM_TIMER) {
-                handle_vterm_timer(buffers, fds[i].fd);
-            } else if (fdtype[i] == FD_TIMER_NO_INPUT) {
-                handle_input_timeout(buffers, fds[i].fd);
+            }
+            if (serial_stalled && !handle_serial(buffers, serial_fd, 0u)) {
+                unwatch(serial_fd);
+                serial_fd = -1;
+                serial_stalled = false;
+            }
+        }
+        // Only ask for EPOLLOUT while there is something to write, or every wakeup would be a busy one
+        bool wants_out = !buffers.pty_out.empty();
+        if (progout_fd != -1 && wants_out != progout_wants_out) {
+            struct epoll_event ev = {};
+            ev.events = EPOLLIN | (wants_out ? EPOLLOUT : 0u);
+            ev.data.fd = progout_fd;
+            epoll_ctl(epfd, EPOLL_CTL_MOD, progout_fd, &ev);
+            progout_wants_out = wants_out;
+        }
+        struct epoll_event events[16];
+        int nevents = epoll_wait(epfd, events, 16, -1);
+        if (nevents == -1 && errno != EINTR) {
+            perror("epoll_wait");
+            exit(1);
+        }
+        woke_us = monotonic_us();
+        wakeups += 1u;
+        wakeup_events += static_cast<uint64_t>(std::max(nevents, 0));
+        for (int i = 0; i < nevents; i++) {
+            int fd = events[i].data.fd;
+            auto it = handlers.find(fd);
+            // unwatched by an earlier handler of this batch
+            if (it == handlers.end()) continue;
+            if (!(this->*(it->second))(buffers, fd, events[i].events)) {
+                unwatch(fd);
             }
         }
     }
@@ -302,10 +443,7 @@ public:
         FBInkInputDevice* devices = fbink_input_scan(match, 0U, 0U, &dev_count);
         if (devices) {
             for (FBInkInputDevice* device = devices; device < devices + dev_count; device++) {
-                if (device->matched) {
-                    fdtype[nfds] = FD_EVDEV;
-                    fds[nfds].events = POLLIN;
-                    fds[nfds++].fd = device->fd;
+                if (device->matched && watch(device->fd, EPOLLIN | EPOLLET, &Inputs::handle_evdev)) {
                     printf("Opened input device `%s` @ `%s`\n", device->name, device->path);
                 }
             }
@@ -314,18 +452,37 @@ public:
     }
 
     void add_progout(int fd) {
-        fdtype[nfds] = FD_PROGOUT;
-        fds[nfds].events = POLLIN | POLLHUP;
-        fds[nfds++].fd = fd;
+        // Level-triggered, so a flood of output can't starve everything else (see handle_progout)
+        if (!watch(fd, EPOLLIN, &Inputs::handle_progout)) {
+            exit(1);
+        }
+        progout_fd = fd;
     }
 
-    void add_vterm_timer(int fd, VTermToFBInk * vt) {
-        fdtype[nfds] = FD_VTERM_TIMER;
-        fds[nfds].events = POLLIN;
-        fds[nfds++].fd = fd;
+    void add_frame_timer(int fd, VTermToFBInk * vt) {
+        watch(fd, EPOLLIN | EPOLLET, &Inputs::handle_frame_timer);
         this->vterm = vt;
     }
 
+    // Updates vt->panel waited for completed
+    void add_panel(VTermToFBInk * vt) {
+        watch(vt->panel.eventfd, EPOLLIN | EPOLLET, &Inputs::handle_panel);
+        this->vterm = vt;
+    }
+
+    // vt's render thread finished a frame or a refresh: the next frame may be ready to go
+    void add_render(VTermToFBInk * vt) {
+        watch(vt->renderer.done_fd, EPOLLIN | EPOLLET, &Inputs::handle_render);
+        this->vterm = vt;
+    }
+
+    // The main loop gets the recording instead of a shell, see Replay::feed()
+    void add_replay(Replay * r) {
+        watch(r->timerfd, EPOLLIN | EPOLLET, &Inputs::handle_replay_timer);
+        this->replay = r;
+        r->arm(1);
+    }
+
     bool add_serial() {
 #ifdef TARGET_KOBO
         // NOTE: Do our best to make this mostly portable...
@@ -376,12 +533,10 @@ public:
         nanosleep(&zzz, nullptr);
 
         int fd = open("/dev/ttyGS0", O_RDONLY | O_NONBLOCK | O_CLOEXEC);
-        if (fd != -1) {
-            fdtype[nfds] = FD_SERIAL;
-            fds[nfds].events = POLLIN;
-            fds[nfds++].fd = fd;
+        if (fd != -1 && watch(fd, EPOLLIN | EPOLLET, &Inputs::handle_serial)) {
             puts("opening /dev/ttyGS0");
             setup_serial(fd);
+            serial_fd = fd;
             return true;
         } else {
             printf("couldn't open /dev/ttyGS0: %m\n");
@@ -397,8 +552,13 @@ public:
         if (server.setup(port) < -1) {
             return -1;
         }
-        fdtype[nfds] = FD_SERVER;
-        fds[nfds++] = server.get_pollfd();
+        watch(server.fd, EPOLLIN | EPOLLET, &Inputs::handle_server);
+        server.search = [this](const std::string & query, uint64_t line) {
+            return vterm ? vterm->search_list(query, line, SEARCH_HTTP_MATCHES) : std::string();
+        };
+        server.metrics = [this]() {
+            return metrics();
+        };
         return 0;
     }
 
@@ -414,10 +574,7 @@ public:
         tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw);
         int flags = fcntl(STDIN_FILENO, F_GETFL, 0);
         fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK);
-        fdtype[nfds] = FD_STDIN;
-        fds[nfds].events = POLLIN;
-        fds[nfds].revents = 0;
-        fds[nfds++].fd = STDIN_FILENO;
+        watch(STDIN_FILENO, EPOLLIN | EPOLLET, &Inputs::handle_stdin);
     }
 
     void add_signals(std::vector<int> signals) {
@@ -433,25 +590,38 @@ public:
             perror("sigprocmask");
             exit(1);
         }
-        int fd = signalfd(-1, &mask, 0);
+        int fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
         if (fd == -1) {
             perror("signalfd");
             exit(1);
         }
-        fdtype[nfds] = FD_SIGNAL;
-        fds[nfds].events = POLLIN;
-        fds[nfds].revents = 0;
-        fds[nfds++].fd = fd;
+        watch(fd, EPOLLIN | EPOLLET, &Inputs::handle_signal);
     }
 
     void add_signals() {
-        add_signals({SIGINT, SIGQUIT});
+        add_signals({SIGINT, SIGQUIT, SIGUSR1});
     }
 
     void atexit() {
         tcsetattr(STDIN_FILENO, TCSAFLUSH, &termios_reset);
     }
 
+    // Everything for GET /metrics and SIGUSR1
+    std::string metrics() const {
+        std::string out;
+        if (vterm) vterm->metrics_text(out);
+        metric(out, "inkvt_wakeups_total", "counter", "Returns from epoll_wait()", wakeups);
+        metric(out, "inkvt_wakeup_events_total", "counter", "Events epoll_wait() returned", wakeup_events);
+        wakeup_time.print(out, "inkvt_wakeup_seconds", "Time spent handling a wakeup, until the next epoll_wait()");
+        input_metrics(out, { { "serial", &serial_stats }, { "http", &server.stats } });
+        return out;
+    }
+
+    void print_stats() const {
+        serial_stats.print("serial");
+        server.stats.print("http");
+    }
+
     void add_exit_after(int seconds) {
         itimerspec ts;
         int timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
@@ -468,9 +638,7 @@ public:
             perror("add_exit_after:timerfd_settime");
             exit(1);
         }
-        fdtype[nfds] = FD_TIMER_NO_INPUT;
-        fds[nfds].events = POLLIN;
-        fds[nfds++].fd = timerfd;
+        watch(timerfd, EPOLLIN | EPOLLET, &Inputs::handle_input_timeout);
     }
 
 };
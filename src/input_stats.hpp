@@ -0,0 +1,79 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <algorithm>
+
+static long monotonic_us() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000L + ts.tv_nsec / 1000L;
+}
+
+// Throughput and latency of one input source (serial, http, ...).
+// Latency is from the read() until everything queued up to then was handed to the shell.
+struct InputStats {
+    uint64_t bytes = 0u;
+    uint64_t reads = 0u;
+    uint64_t max_read = 0u;
+    long first_us = -1;
+    long last_us = -1;
+    // input that is still on its way to the shell arrived at pending_us
+    long pending_us = -1;
+    uint64_t deliveries = 0u;
+    long latency_sum_us = 0;
+    long latency_max_us = 0;
+
+    void add_read(size_t n) {
+        long now = monotonic_us();
+        bytes += n;
+        reads += 1u;
+        max_read = std::max<uint64_t>(max_read, n);
+        if (first_us == -1) first_us = now;
+        last_us = now;
+        if (pending_us == -1) pending_us = now;
+    }
+
+    // The pty queue ran empty
+    void delivered() {
+        if (pending_us == -1) return;
+        long latency = monotonic_us() - pending_us;
+        deliveries += 1u;
+        latency_sum_us += latency;
+        latency_max_us = std::max(latency_max_us, latency);
+        pending_us = -1;
+    }
+
+    void print(const char * name) const {
+        if (reads == 0u) return;
+        double seconds = static_cast<double>(last_us - first_us) / 1e6;
+        printf("%s: %llu bytes in %llu reads (%.1f per read, max %llu), %.1f KB/s, latency avg %.2f ms max %.2f ms\n",
+                name,
+                static_cast<unsigned long long>(bytes),
+                static_cast<unsigned long long>(reads),
+                static_cast<double>(bytes) / static_cast<double>(reads),
+                static_cast<unsigned long long>(max_read),
+                seconds > 0.0 ? static_cast<double>(bytes) / 1024.0 / seconds : 0.0,
+                deliveries ? static_cast<double>(latency_sum_us) / static_cast<double>(deliveries) / 1000.0 : 0.0,
+                static_cast<double>(latency_max_us) / 1000.0);
+    }
+};
@@ -18,22 +18,31 @@
 #pragma once
 
 #include <fcntl.h>
-#include <poll.h>
 #include <signal.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <errno.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <arpa/inet.h>
 #include <net/if.h>
 
-#include <vector>
-#include <sstream>
+#include <strings.h>
+#include <ctype.h>
+
 #include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "../libvterm/include/vterm.h"
 #include "_kbsend.hpp"
+#include "buffers.hpp"
+#include "input_stats.hpp"
+#include "websocket.hpp"
 
 #ifndef GITHASH
 #define GITHASH "<unknown>"
@@ -47,27 +56,384 @@
 #define server_try(x) (err = (x), (err < 0? \
         (printf("ERROR: " #x " = %ld (errno = %s)\n", err, strerror(errno)), exit(1)) : (void)0), err)
 
+// longest request or header line we accept, the connection is dropped beyond that
+constexpr size_t MAX_HEADER_LINE = 8u * 1024u;
+// a stalled paste resumes once the pty queue has room for <n> bytes
+constexpr size_t PASTE_RESUME_SPACE = 4u * 1024u;
+
 class Server {
+    // One client, parsed incrementally as its bytes trickle in
+    struct Connection {
+        enum {
+            REQUEST_LINE,
+            HEADERS,
+            BODY,
+            WEBSOCKET, // upgraded: everything from here on are WebSocket frames with keystrokes
+        } state = REQUEST_LINE;
+        // the request or header line read so far
+        std::string line;
+        // what the headers told us about the current request
+        enum {
+            PAGE,      // GET: kbsend.html
+            KEYS,      // POST /: hex encoded keys
+            PASTE,     // POST /paste: raw bytes, pasted as a whole
+            PREFLIGHT, // OPTIONS: CORS, for pastes from kbsend.html served elsewhere
+            SEARCH,    // GET /search?q=...&line=...: scrollback matches as text
+            METRICS,   // GET /metrics: counters and histograms, Prometheus text format
+        } kind = PAGE;
+        // the query string of a SEARCH
+        std::string query;
+        bool keep_alive = true;
+        bool upgrade = false;
+        std::string ws_key;
+        size_t content_length = 0u;
+        // body bytes still to come
+        size_t remaining = 0u;
+        // first half of a hex encoded byte split over two reads, -1 if none
+        int high_nibble = -1;
+        // the paste start marker went out
+        bool paste_started = false;
+        // bytes we read but couldn't queue for the pty yet, nothing more is read until they are
+        std::string pending;
+        // waiting for room in the pty queue
+        bool stalled = false;
+        bool accepts_gzip = false;
+        // If-None-Match named the ETag of kbsend.html
+        bool has_page = false;
+        // response bytes the socket didn't take yet: out, then the static body behind it
+        std::string out;
+        const char * body = nullptr;
+        size_t body_left = 0u;
+        // after out is sent, close
+        bool done = false;
+        WebSocket ws;
+    };
+    std::unordered_map<int, Connection> connections;
+
     int hexdigit(char c) {
         if (c >= '0' && c <= '9') return c - '0';
         if (c >= 'a' && c <= 'f') return c - 'a' + 10;
         if (c >= 'A' && c <= 'F') return c - 'A' + 10;
         return 0;
     }
+
+    // Queues raw bytes, they go out after whatever is queued already
+    static void queue(Connection & c, const std::string & bytes) {
+        if (c.body_left > 0u) {
+            c.out.append(c.body, c.body_left);
+            c.body_left = 0u;
+        }
+        c.out += bytes;
+    }
+
+    // Queues a response. body is static (a literal or an embedded asset), so it is not copied:
+    // flush() sends it right from where it is, in the same call as the headers.
+    static void respond(Connection & c, const char * status, const char * headers, const char * body, size_t len) {
+        char length[64] = "";
+        // 204 and 304 have no body, and no Content-Length either
+        if (strncmp(status, "204", 3) != 0 && strncmp(status, "304", 3) != 0) {
+            snprintf(length, sizeof(length), "Content-Length: %zu\r\n", len);
+        }
+        char buf[512];
+        snprintf(buf, sizeof(buf),
+            "HTTP/1.1 %s\r\n"
+            "Access-Control-Allow-Origin: *\r\n"
+            "%s"
+            "%s"
+            "%s"
+            "\r\n", status, headers, length, c.keep_alive ? "" : "Connection: close\r\n");
+        queue(c, buf);
+        c.body = body;
+        c.body_left = len;
+    }
+
+    // A response with text made up on the spot: it goes right behind the headers
+    static void respond_text(Connection & c, const std::string & text) {
+        respond(c, "200 OK", "Content-Type: text/plain; charset=UTF-8\r\n", nullptr, text.size());
+        c.body_left = 0u;
+        queue(c, text);
+    }
+
+    // Value of a query string parameter, with %xx and + decoded
+    std::string query_param(const std::string & query, const char * name) {
+        std::string key = std::string(name) + "=";
+        size_t start = 0u;
+        while (start < query.size()) {
+            size_t end = query.find('&', start);
+            if (end == std::string::npos) end = query.size();
+            if (query.compare(start, key.size(), key) == 0) {
+                std::string value;
+                for (size_t i = start + key.size(); i < end; i++) {
+                    if (query[i] == '+') {
+                        value.push_back(' ');
+                    } else if (query[i] == '%' && i + 2u < end) {
+                        value.push_back(static_cast<char>(hexdigit(query[i + 1u]) << 4 | hexdigit(query[i + 2u])));
+                        i += 2u;
+                    } else {
+                        value.push_back(query[i]);
+                    }
+                }
+                return value;
+            }
+            start = end + 1u;
+        }
+        return "";
+    }
+
+    void respond_page(Connection & c) {
+        static const char page_headers[] =
+            "Content-Type: text/html; charset=UTF-8\r\n"
+            "ETag: " KBSEND_ETAG "\r\n"
+            "Cache-Control: max-age=3600\r\n"
+            "Vary: Accept-Encoding\r\n";
+        static const char gzip_headers[] =
+            "Content-Type: text/html; charset=UTF-8\r\n"
+            "Content-Encoding: gzip\r\n"
+            "ETag: " KBSEND_ETAG "\r\n"
+            "Cache-Control: max-age=3600\r\n"
+            "Vary: Accept-Encoding\r\n";
+        if (c.has_page) {
+            respond(c, "304 Not Modified", page_headers, nullptr, 0u);
+        } else if (c.accepts_gzip) {
+            respond(c, "200 OK", gzip_headers, reinterpret_cast<const char *>(src_kbsend_html_gz), src_kbsend_html_gz_len);
+        } else {
+            respond(c, "200 OK", page_headers, reinterpret_cast<const char *>(src_kbsend_html), src_kbsend_html_len);
+        }
+    }
+
+    // The request is complete: answer it, and get ready for the next one on the same connection
+    void end_request(Connection & c) {
+        if (c.kind == Connection::PREFLIGHT) {
+            respond(c, "204 No Content",
+                    "Access-Control-Allow-Methods: GET, POST\r\n"
+                    "Access-Control-Allow-Headers: Content-Type\r\n", nullptr, 0u);
+        } else if (c.kind == Connection::SEARCH) {
+            std::string line = query_param(c.query, "line");
+            respond_text(c, search ? search(query_param(c.query, "q"), line.empty() ? UINT64_MAX : strtoull(line.c_str(), nullptr, 10)) : "");
+        } else if (c.kind == Connection::METRICS) {
+            respond_text(c, metrics ? metrics() : "");
+        } else if (c.kind != Connection::PAGE) {
+            static const char ok[] = "ok.\n";
+            respond(c, "200 OK", "Content-Type: text/plain; charset=UTF-8\r\n", ok, sizeof(ok) - 1u);
+        } else {
+            respond_page(c);
+        }
+        c.done = !c.keep_alive;
+        c.accepts_gzip = false;
+        c.has_page = false;
+        c.state = Connection::REQUEST_LINE;
+        c.kind = Connection::PAGE;
+        c.paste_started = false;
+        c.keep_alive = true;
+        c.upgrade = false;
+        c.ws_key.clear();
+        c.content_length = 0u;
+        c.high_nibble = -1;
+        c.query.clear();
+    }
+
+    void end_headers(Connection & c) {
+        if (c.upgrade && !c.ws_key.empty()) {
+            queue(c, "HTTP/1.1 101 Switching Protocols\r\n"
+                     "Upgrade: websocket\r\n"
+                     "Connection: Upgrade\r\n"
+                     "Sec-WebSocket-Accept: " + WebSocket::accept_key(c.ws_key) + "\r\n"
+                     "\r\n");
+            c.state = Connection::WEBSOCKET;
+        } else if (c.kind == Connection::PASTE) {
+            // Even an empty paste gets its markers
+            c.remaining = c.content_length;
+            c.state = Connection::BODY;
+        } else if (c.kind == Connection::KEYS && c.content_length > 0u) {
+            c.remaining = c.content_length;
+            c.state = Connection::BODY;
+        } else {
+            end_request(c);
+        }
+    }
+
+    // A complete request or header line, without its line ending
+    void parse_line(Connection & c, const std::string & line) {
+        if (c.state == Connection::REQUEST_LINE) {
+            // Tolerate empty lines between requests
+            if (line.empty()) return;
+            if (line.rfind("POST /paste ", 0) == 0 || line.rfind("POST /paste?", 0) == 0) {
+                c.kind = Connection::PASTE;
+            } else if (line.rfind("POST ", 0) == 0) {
+                c.kind = Connection::KEYS;
+            } else if (line.rfind("OPTIONS ", 0) == 0) {
+                c.kind = Connection::PREFLIGHT;
+            } else if (line.rfind("GET /search?", 0) == 0) {
+                c.kind = Connection::SEARCH;
+                size_t start = strlen("GET /search?");
+                c.query = line.substr(start, line.find(' ', start) - start);
+            } else if (line.rfind("GET /metrics ", 0) == 0) {
+                c.kind = Connection::METRICS;
+            } else {
+                c.kind = Connection::PAGE;
+            }
+            c.keep_alive = line.find("HTTP/1.0") == std::string::npos;
+            c.state = Connection::HEADERS;
+            return;
+        }
+        if (line.empty()) {
+            end_headers(c);
+            return;
+        }
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) return;
+        std::string name = line.substr(0u, colon);
+        size_t start = line.find_first_not_of(" \t", colon + 1u);
+        std::string value = start == std::string::npos ? "" : line.substr(start);
+        if (strcasecmp(name.c_str(), "Content-Length") == 0) {
+            c.content_length = strtoul(value.c_str(), nullptr, 10);
+        } else if (strcasecmp(name.c_str(), "Connection") == 0) {
+            if (strcasecmp(value.c_str(), "close") == 0) {
+                c.keep_alive = false;
+            } else if (strcasecmp(value.c_str(), "keep-alive") == 0) {
+                c.keep_alive = true;
+            }
+        } else if (strcasecmp(name.c_str(), "Upgrade") == 0) {
+            c.upgrade = strcasecmp(value.c_str(), "websocket") == 0;
+        } else if (strcasecmp(name.c_str(), "Sec-WebSocket-Key") == 0) {
+            c.ws_key = value;
+        } else if (strcasecmp(name.c_str(), "Accept-Encoding") == 0) {
+            c.accepts_gzip = value.find("gzip") != std::string::npos;
+        } else if (strcasecmp(name.c_str(), "If-None-Match") == 0) {
+            c.has_page = value.find(KBSEND_ETAG) != std::string::npos || value == "*";
+        }
+    }
+
+    // Hex encoded keys, whitespace is ignored
+    void decode_body(Connection & c, const char * data, size_t len, std::deque<char> & output) {
+        for (size_t i = 0u; i < len; i++) {
+            if (isspace(static_cast<unsigned char>(data[i]))) continue;
+            if (c.high_nibble < 0) {
+                c.high_nibble = hexdigit(data[i]);
+            } else {
+                output.push_back(static_cast<char>((c.high_nibble << 4) | hexdigit(data[i])));
+                c.high_nibble = -1;
+            }
+        }
+    }
+
+    // Bracketed paste markers come from libvterm, which only sends them when the application enabled mode 2004.
+    // They go out together with anything else libvterm had to say, false if there is no room for that yet.
+    static bool paste_marker(RingBuffer & pty_out, VTerm * term, bool start) {
+        if (pty_out.space() < vterm_output_get_buffer_current(term) + 16u) return false;
+        if (start) {
+            vterm_keyboard_start_paste(term);
+        } else {
+            vterm_keyboard_end_paste(term);
+        }
+        pty_out.fill([term](char * dst, size_t n) { return vterm_output_read(term, dst, n); });
+        return true;
+    }
+
+    // Moves paste bytes into the pty queue, returns how many fit
+    size_t paste(Connection & c, const char * data, size_t len, RingBuffer & pty_out, VTerm * term) {
+        if (!c.paste_started) {
+            if (!paste_marker(pty_out, term, true)) return 0u;
+            c.paste_started = true;
+        }
+        size_t n = pty_out.write(data, len);
+        c.remaining -= n;
+        if (c.remaining == 0u) {
+            if (!paste_marker(pty_out, term, false)) return n;
+            end_request(c);
+        }
+        return n;
+    }
+
+    // Runs the bytes of a read through the state machine, returns false to drop the connection.
+    // Stops early when the pty queue is full, see Connection::pending.
+    bool feed(Connection & c, const char * data, size_t len, Buffers & buffers, VTerm * term) {
+        std::deque<char> & output = buffers.keyboard;
+        const char * end = data + len;
+        while (!c.done) {
+            if (c.state == Connection::BODY && c.kind == Connection::PASTE) {
+                // Runs even without data, for the markers of empty pastes and of stalled ones
+                size_t n = paste(c, data, std::min(c.remaining, static_cast<size_t>(end - data)), buffers.pty_out, term);
+                buffers.typed_direct.append(data, n);
+                data += n;
+                if (c.state == Connection::BODY) {
+                    if (data < end || c.remaining == 0u) {
+                        c.pending.assign(data, end);
+                        c.stalled = true;
+                    }
+                    return true;
+                }
+                continue;
+            }
+            if (data >= end) break;
+            if (c.state == Connection::WEBSOCKET) {
+                c.ws.feed(data, static_cast<size_t>(end - data), output, c.out);
+                c.done = c.ws.closed;
+                return true;
+            }
+            if (c.state == Connection::BODY) {
+                size_t n = std::min(c.remaining, static_cast<size_t>(end - data));
+                decode_body(c, data, n, output);
+                data += n;
+                c.remaining -= n;
+                if (c.remaining == 0u) {
+                    end_request(c);
+                }
+                continue;
+            }
+            const char * eol = static_cast<const char *>(memchr(data, '\n', static_cast<size_t>(end - data)));
+            const char * stop = eol ? eol : end;
+            c.line.append(data, static_cast<size_t>(stop - data));
+            if (c.line.size() > MAX_HEADER_LINE) {
+                return false;
+            }
+            data = eol ? eol + 1 : end;
+            if (eol) {
+                if (!c.line.empty() && c.line.back() == '\r') {
+                    c.line.pop_back();
+                }
+                std::string line;
+                line.swap(c.line);
+                parse_line(c, line);
+            }
+        }
+        return true;
+    }
+
+    // Sends as much of c.out and c.body as the socket takes, both in one sendmsg(), false on errors
+    static bool flush(int clientfd, Connection & c) {
+        while (!c.out.empty() || c.body_left > 0u) {
+            iovec iov[2] = {
+                { &c.out[0], c.out.size() },
+                { const_cast<char *>(c.body), c.body_left },
+            };
+            msghdr msg = {};
+            msg.msg_iov = c.out.empty() ? &iov[1] : &iov[0];
+            msg.msg_iovlen = c.out.empty() || c.body_left == 0u ? 1u : 2u;
+            ssize_t nsent = sendmsg(clientfd, &msg, MSG_NOSIGNAL);
+            if (nsent < 0) {
+                return errno == EAGAIN;
+            }
+            size_t n = static_cast<size_t>(nsent);
+            size_t from_out = std::min(n, c.out.size());
+            c.out.erase(0u, from_out);
+            c.body += n - from_out;
+            c.body_left -= n - from_out;
+        }
+        return true;
+    }
 public:
     int fd = -1;
+    // everything read from clients, WebSocket keys and pastes alike
+    InputStats stats;
+    // answers GET /search: the matches of a query, newest first, and shows the one on the given line
+    std::function<std::string(const std::string & query, uint64_t line)> search;
+    // answers GET /metrics
+    std::function<std::string()> metrics;
     int port = -1;
     struct sockaddr_in address;
     struct ifreq ifr;
 
-    struct pollfd get_pollfd() {
-        pollfd ret;
-        ret.fd = fd;
-        ret.events = POLLIN;
-        ret.revents = 0;
-        return ret;
-    }
-
     int setup(uint16_t setup_port) {
         long err;
         int opt = 1;
@@ -104,56 +470,73 @@ public:
         return 0;
     }
 
-    void accept(std::deque<char> & output) {
-        // blocking read
-        static char response_headers[] =
-            "HTTP/1.1 200 OK\r\n"
-            "Access-Control-Allow-Origin: *\r\n"
-            "Content-Type: text/html; charset=UTF-8\r\n"
-            "Connection: close\r\n"
-            "\r\n";
-        char buffer[1024] = {0};
-        int clientfd;
+    // Accepts one client, returns its non-blocking fd, or -1 when there was nobody left to accept.
+    // Hand it to handle() whenever it is readable or writable.
+    int accept() {
         int addrlen = sizeof(address);
-        clientfd = ::accept(fd, (struct sockaddr *)&address, (socklen_t*)&addrlen);
+        int clientfd = accept4(fd, (struct sockaddr *)&address, (socklen_t*)&addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
         if (clientfd == -1) {
-            if (errno == EAGAIN) return;
-            perror("accept");
-            exit(1);
+            if (errno != EAGAIN) {
+                perror("accept");
+            }
+            return -1;
         }
-        ssize_t nread = read(clientfd, buffer, sizeof(buffer)-1);
-        if (nread <= 0) {
-            close(clientfd);
-            return;
+        connections[clientfd] = Connection();
+        return clientfd;
+    }
+
+    // Connections that stopped reading because the pty queue was full,
+    // call handle() again for them once it drained
+    std::vector<int> stalled() const {
+        std::vector<int> fds;
+        for (const auto & it : connections) {
+            if (it.second.stalled) {
+                fds.push_back(it.first);
+            }
         }
-        std::stringstream ss;
-        ss.write(buffer, nread);
-        std::string header;
-        buffer[nread] = 0;
-        bool is_post = false;
-        if (std::getline(ss, header)) {
-            if (header.rfind("POST", 0) == 0) {
-                is_post = true;
-            }
-        }
-        while (std::getline(ss, header)) {
-            /* HTTP header/body separator is \r\n\r\n
-             * "\r\n".length() with \n removed is 1 */
-            if (header.length() == 1) break;
-        }
-        if (is_post) {
-            char c1;
-            char c2;
-            while ((ss >> c1) && (ss >> c2)) {
-                output.push_back(static_cast<char>((hexdigit(c1)<<4) | hexdigit(c2)));
-            }
-            static char ok[] = "ok.\n";
-            send(clientfd, response_headers , sizeof(response_headers)-1 , 0);
-            send(clientfd, ok , sizeof(ok)-1 , 0);
-        } else {
-            send(clientfd, response_headers , sizeof(response_headers)-1 , 0);
-            send(clientfd, src_kbsend_html, src_kbsend_html_len, 0);
+        return fds;
+    }
+
+    // Reads whatever the client sent and sends what is due:
+    // keys go to buffers.keyboard, pastes to buffers.pty_out, bracketed if term asked for that.
+    // Returns false once the connection is done, the caller closes clientfd then.
+    bool handle(int clientfd, Buffers & buffers, VTerm * term) {
+        auto it = connections.find(clientfd);
+        if (it == connections.end()) return false;
+        Connection & c = it->second;
+        char buffer[4096];
+        bool open = flush(clientfd, c);
+        if (c.stalled) {
+            // Whatever was held back goes first
+            c.stalled = false;
+            std::string pending;
+            pending.swap(c.pending);
+            open = open && feed(c, pending.data(), pending.size(), buffers, term);
+        }
+        while (open && !c.done && !c.stalled) {
+            ssize_t nread = read(clientfd, buffer, sizeof(buffer));
+            if (nread < 0 && errno == EAGAIN) break;
+            if (nread == 0) {
+                // Still answer what the client asked for before hanging up
+                c.done = true;
+                break;
+            }
+            if (nread < 0) {
+                open = false;
+                break;
+            }
+            stats.add_read(static_cast<size_t>(nread));
+            if (!feed(c, buffer, static_cast<size_t>(nread), buffers, term)) {
+                open = false;
+                break;
+            }
+        }
+        open = open && flush(clientfd, c);
+        // A partial send can leave the static body behind c.out, close only once both went out
+        if (!open || (c.done && c.out.empty() && c.body_left == 0u)) {
+            connections.erase(it);
+            return false;
         }
-        close(clientfd);
+        return true;
     }
 };
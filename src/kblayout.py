@@ -12,7 +12,7 @@ w = 'width'
 rows = [
     ["~\n`","!\n1\nF1","@\n2\nF2","#\n3\nF3","$\n4\nF4","%\n5\nF5","^\n6\nF6","&\n7\nF7","*\n8\nF8","(\n9\nF9",")\n0\nF10","_\n-\nF11","+\n=\nF12",{w:2},"\nBackspace"],
     [{w:1.5},"Tab","Q\nq","W\nw","E\ne","R\nr","T\nt","Y\ny","U\nu","I\ni","O\no","P\np","{\n[","}\n]",{w:1.5},"|\n\\"],
-    [{w:1.75},"Escape","A\na","S\ns","D\nd","F\nf","G\ng","H\nh","J\nj","K\nk","L\nl",":\n;","\"\n'",{w:2.25},"Enter"],
+    [{w:1.75},"Escape","A\na","S\ns","D\nd","F\nf\nFind","G\ng","H\nh","J\nj","K\nk","L\nl",":\n;","\"\n'",{w:2.25},"Enter"],
     [{w:2.25},"Shift\n\nMOD","Z\nz","X\nx","C\nc","V\nv","B\nb","N\nn","M\nm","<\n,",">\n.","?\n/",{w:2.75},"Shift\n\nMOD"],
     [{w:1.25},"Ctrl\n\nMOD",{w:1.25},"Fn\n\nMOD",{w:1.25},"Alt\n\nMOD",{w:6.25},"Space",{w:1.25},"\nLeft",{w:1.25},"\nDown",{w:1.25},"\nUp",{w:1.25},"\nRight"]
 ]
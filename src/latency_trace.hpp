@@ -0,0 +1,195 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <string>
+
+#include "input_stats.hpp"
+#include "metrics.hpp"
+
+// chunks of input followed at once, the oldest is dropped when more arrive before it is on the screen
+constexpr size_t TRACE_CHUNKS = 32u;
+// chunks that are not on the screen after <n> us (e.g., keys the program doesn't echo) are dropped
+constexpr long TRACE_TIMEOUT_US = 5000000L;
+
+enum TraceSource { TRACE_HTTP, TRACE_SERIAL, TRACE_STDIN, TRACE_EVDEV, TRACE_OSK };
+
+// How far a chunk of input got on its way to the panel, in this order
+enum TraceStage {
+    TRACE_ARRIVED,   // read from its source
+    TRACE_WRITTEN,   // everything queued for the pty was written to it
+    TRACE_ECHOED,    // the first read from the pty after that
+    TRACE_DRAWN,     // the render thread drew the first frame after that
+    TRACE_SUBMITTED, // the first refresh after that
+    TRACE_COMPLETE,  // the panel finished that refresh
+    TRACE_STAGES,
+};
+
+// Follows chunks of input from the read() that got them to the refresh that shows the program's answer.
+// Every stage is stamped by whoever gets there: the first event of a stage after a chunk reached the previous one
+// counts, so chunks that are typed faster than they are echoed share the later stages.
+class LatencyTrace {
+    struct Chunk {
+        TraceSource source;
+        size_t bytes;
+        long t[TRACE_STAGES];
+        TraceStage stage;
+        // the frame it is drawn in, once it's ECHOED and handed to the render thread
+        uint64_t frame;
+        // the update marker of the refresh it was submitted with
+        uint32_t marker;
+    };
+    Chunk ring[TRACE_CHUNKS];
+    size_t first = 0u;
+    size_t count = 0u;
+    FILE * file = nullptr;
+
+    Chunk & at(size_t i) {
+        return ring[(first + i) % TRACE_CHUNKS];
+    }
+
+    void pop() {
+        first = (first + 1u) % TRACE_CHUNKS;
+        count -= 1u;
+    }
+
+    // Every chunk that is at the stage before (and in frame, or an earlier one) moves on to this one at t_us,
+    // or now if that's -1. True if there were any.
+    bool advance(TraceStage stage, long t_us = -1, uint64_t frame = UINT64_MAX, uint32_t marker = 0u) {
+        bool any = false;
+        for (size_t i = 0u; i < count; i++) {
+            Chunk & c = at(i);
+            if (c.stage != stage - 1 || c.frame > frame) continue;
+            if (t_us == -1) t_us = monotonic_us();
+            c.t[stage] = std::max(t_us, c.t[stage - 1]);
+            c.stage = stage;
+            c.marker = marker;
+            any = true;
+        }
+        return any;
+    }
+
+    // Chunks are done in order: the oldest one holds back the others until it is
+    void finish() {
+        while (count > 0u && at(0u).stage == TRACE_COMPLETE) {
+            const Chunk & c = at(0u);
+            for (int stage = TRACE_WRITTEN; stage < TRACE_STAGES; stage++) {
+                stage_time[stage].add(c.t[stage] - c.t[stage - 1]);
+            }
+            total.add(c.t[TRACE_COMPLETE] - c.t[TRACE_ARRIVED]);
+            if (file) {
+                static const char * const sources[] = { "http", "serial", "stdin", "evdev", "osk" };
+                fprintf(file, "%ld\t%s\t%zu", c.t[TRACE_ARRIVED], sources[c.source], c.bytes);
+                for (int stage = TRACE_WRITTEN; stage < TRACE_STAGES; stage++) {
+                    fprintf(file, "\t%ld", c.t[stage] - c.t[stage - 1]);
+                }
+                fputc('\n', file);
+                fflush(file);
+            }
+            pop();
+        }
+    }
+
+public:
+    // time from the previous stage to this one, of every chunk that made it to the screen
+    Histogram stage_time[TRACE_STAGES];
+    Histogram total;
+
+    // Also write every chunk that made it to the screen to path, one line each
+    void open(const char * path) {
+        file = fopen(path, "w");
+        if (!file) {
+            perror("--trace");
+            exit(1);
+        }
+        fputs("# arrived_us\tsource\tbytes\twritten_us\techoed_us\tdrawn_us\tsubmitted_us\tcomplete_us\n", file);
+    }
+
+    void close() {
+        if (file) fclose(file);
+        file = nullptr;
+    }
+
+    void arrived(TraceSource source, size_t bytes) {
+        if (bytes == 0u) return;
+        long now = monotonic_us();
+        while (count > 0u && (count == TRACE_CHUNKS || now - at(0u).t[TRACE_ARRIVED] > TRACE_TIMEOUT_US)) {
+            pop();
+        }
+        Chunk & c = at(count++);
+        c.source = source;
+        c.bytes = bytes;
+        c.t[TRACE_ARRIVED] = now;
+        c.stage = TRACE_ARRIVED;
+        c.frame = UINT64_MAX;
+    }
+
+    // Chunks that did not make it to the pty never will (e.g., keys typed into a search)
+    void discard() {
+        size_t kept = 0u;
+        for (size_t i = 0u; i < count; i++) {
+            if (at(i).stage != TRACE_ARRIVED) {
+                at(kept++) = at(i);
+            }
+        }
+        count = kept;
+    }
+
+    void written() { advance(TRACE_WRITTEN); }
+    void echoed() { advance(TRACE_ECHOED); }
+
+    // What the pty answered so far went to the render thread as that frame
+    void published(uint64_t frame) {
+        for (size_t i = 0u; i < count; i++) {
+            Chunk & c = at(i);
+            if (c.stage == TRACE_ECHOED && c.frame == UINT64_MAX) c.frame = frame;
+        }
+    }
+
+    // The render thread finished drawing that frame at t_us
+    void drawn(uint64_t frame, long t_us) { advance(TRACE_DRAWN, t_us, frame); }
+
+    // The refresh with that marker, of everything up to that frame, was submitted at t_us. True if it shows traced input:
+    // then the caller waits for the panel to complete it, and calls complete()
+    bool submitted(uint64_t frame, uint32_t marker, long t_us) { return advance(TRACE_SUBMITTED, t_us, frame, marker); }
+
+    // The panel completed the refresh with that marker at done_us
+    void complete(uint32_t marker, long done_us) {
+        for (size_t i = 0u; i < count; i++) {
+            Chunk & c = at(i);
+            if (c.stage != TRACE_SUBMITTED || c.marker != marker) continue;
+            c.t[TRACE_COMPLETE] = std::max(done_us, c.t[TRACE_SUBMITTED]);
+            c.stage = TRACE_COMPLETE;
+        }
+        finish();
+    }
+
+    void print(std::string & out) const {
+        stage_time[TRACE_WRITTEN].print(out, "inkvt_trace_queue_seconds", "From reading input until it was written to the pty");
+        stage_time[TRACE_ECHOED].print(out, "inkvt_trace_program_seconds", "From writing input to the pty until the program answered");
+        stage_time[TRACE_DRAWN].print(out, "inkvt_trace_draw_seconds", "From reading the answer until it was drawn");
+        stage_time[TRACE_SUBMITTED].print(out, "inkvt_trace_refresh_seconds", "From drawing the answer until its refresh was submitted");
+        stage_time[TRACE_COMPLETE].print(out, "inkvt_trace_panel_seconds", "From submitting the refresh until the panel completed it");
+        total.print(out, "inkvt_trace_total_seconds", "From reading input until the panel completed the refresh with the answer");
+    }
+};
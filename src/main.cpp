@@ -27,6 +27,8 @@
 #include "./_keymap.hpp"
 #include "./buffers.hpp"
 #include "./osk.hpp"
+#include "./headless_backend.hpp"
+#include "./recording.hpp"
 
 #include "../cxxopts/include/cxxopts.hpp"
 
@@ -38,10 +40,29 @@ Inputs inputs;
 PseudoTTY pty;
 VTermToFBInk vterm;
 KeycodeTranslation keytrans;
+HeadlessBackend * headless = nullptr;
+std::string snapshot_path;
+Recorder recorder;
+Replay replay;
 
 void handle_atexit() {
     puts("atexit_called");
+    recorder.close();
+    vterm.trace.close();
+    vterm.renderer.stop();
+    vterm.panel.stop();
     inputs.atexit();
+    inputs.print_stats();
+    if (headless) {
+        printf("frames %llu, pixels written %llu, refreshes %llu, refresh area %llu px\n",
+                static_cast<unsigned long long>(headless->stats.frames),
+                static_cast<unsigned long long>(headless->stats.pixels_written),
+                static_cast<unsigned long long>(headless->stats.refreshes),
+                static_cast<unsigned long long>(headless->stats.refresh_area));
+        if (snapshot_path.length() > 0) {
+            headless->write_pgm(snapshot_path.c_str());
+        }
+    }
 }
 
 void deque_printf(std::deque<char> & out, const char * fmt, ...) {
@@ -55,14 +76,23 @@ void deque_printf(std::deque<char> & out, const char * fmt, ...) {
     va_end(ap);
 }
 
+void ring_printf(RingBuffer & out, const char * fmt, ...) {
+    char result[1024];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(result, sizeof(result), fmt, ap);
+    out.write(result, strlen(result));
+    va_end(ap);
+}
+
 void print_listen_adresses(Buffers & buffers) {
     struct ifaddrs *ifaddr, *ifa;
     int s;
     char host[NI_MAXHOST];
-    deque_printf(buffers.vt100_in, "listening on:\r\n");
+    ring_printf(buffers.vt100_in, "listening on:\r\n");
     if (getifaddrs(&ifaddr) == -1) {
         perror("getifaddrs");
-        deque_printf(buffers.vt100_in, "    ... could not call getifaddres()\r\n");
+        ring_printf(buffers.vt100_in, "    ... could not call getifaddres()\r\n");
         return;
     }
     for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next) {
@@ -70,7 +100,7 @@ void print_listen_adresses(Buffers & buffers) {
             continue;
         s = getnameinfo(ifa->ifa_addr, sizeof(struct sockaddr_in), host, NI_MAXHOST, nullptr, 0, NI_NUMERICHOST);
         if (s == 0 && ifa->ifa_addr->sa_family == AF_INET) {
-            deque_printf(buffers.vt100_in, "  - %s:%d (%s)\r\n",
+            ring_printf(buffers.vt100_in, "  - %s:%d (%s)\r\n",
                     host, inputs.server.port, ifa->ifa_name);
         }
     }
@@ -90,9 +120,18 @@ int main(int argc, char ** argv) {
         ("f,fontname", "FBInk Bitmap fontname, one of ibm, unscii, unscii_alt, unscii_thin, unscii_fantasy, unscii_mcr, unscii_tall, block, leggie, veggie, kates, fkp, ctrld, orp, orpb, orpi, scientifica, scientificab, scientificai, terminus, terminusb, fatty, spleen, tewi, tewib, topaz, microknight, vga or cozette",
             cxxopts::value<std::string>()->default_value("terminus"))
         ("s,fontsize", "Fontsize multiplier", cxxopts::value<uint8_t>()->default_value("2"))
+        ("latency", "Minimum time between two frames while output keeps coming (ms), lower is snappier, higher batches more", cxxopts::value<int>()->default_value(std::to_string(REFRESH_LATENCY_MS)))
+        ("flash-every", "Flash the screen after this many fast refreshes to clear ghosting (0 to never flash)", cxxopts::value<int>()->default_value(std::to_string(REFRESH_FLASH_EVERY)))
         ("d,debug", "Enable debug", cxxopts::value<bool>()->default_value("false"))
         ("c,shell", "Shell (full path)", cxxopts::value<std::string>()->default_value("/bin/sh"))
         ("i,input", "Initial stdin line (e.g., call init script)", cxxopts::value<std::string>()->default_value(""))
+        ("headless", "Render to memory instead of the framebuffer, as WIDTHxHEIGHT (e.g., 1264x1680), and print render stats on exit", cxxopts::value<std::string>()->default_value(""))
+        ("scrollback", "Keep at most this many MB of lines that scrolled off the top (0 to keep none)", cxxopts::value<size_t>()->default_value(std::to_string(SCROLLBACK_MB)))
+        ("snapshot", "With --headless, write the final screen as a PGM image to this file", cxxopts::value<std::string>()->default_value(""))
+        ("record", "Log the program output, keys and taps to this file, with their timing, for --replay", cxxopts::value<std::string>()->default_value(""))
+        ("replay", "Show a --record file instead of running a shell, then print frames, refreshes and wall time and exit", cxxopts::value<std::string>()->default_value(""))
+        ("replay-speed", "Pace of --replay: 1 as recorded, 2 twice as fast, 0 as fast as it renders", cxxopts::value<double>()->default_value("1"))
+        ("trace", "Log how long every chunk of input took to reach the panel, stage by stage, to this file", cxxopts::value<std::string>()->default_value(""))
     ;
     auto arg_result = arg_options.parse(argc, argv);
     if (arg_result.count("help")) {
@@ -100,52 +139,94 @@ int main(int argc, char ** argv) {
         exit(0);
     }
     Buffers buffers;
+    std::string replay_path = arg_result["replay"].as<std::string>();
+    // No shell, no other input: only what was recorded
+    bool replaying = replay_path.length() > 0;
     std::string shell = arg_result["shell"].as<std::string>();
-    pty.setup(shell.c_str());
+    if (!replaying) {
+        pty.setup(shell.c_str());
+    }
     std::string init_stdin_line = arg_result["input"].as<std::string>();
-    if (init_stdin_line.length() > 0) {
+    if (init_stdin_line.length() > 0 && !replaying) {
         deque_printf(buffers.keyboard, "%s\r\n", init_stdin_line.c_str());
     }
     std::string fontname = arg_result["fontname"].as<std::string>();
     vterm.has_osk = arg_result["osk"].as<bool>();
-    if (vterm.has_osk) {
+    if (vterm.has_osk && !replaying) {
         inputs.add_evdev();
     }
     bool debug = arg_result["debug"].as<bool>();
+    std::string headless_size = arg_result["headless"].as<std::string>();
+    if (headless_size.length() > 0) {
+        unsigned int width, height;
+        if (sscanf(headless_size.c_str(), "%ux%u", &width, &height) != 2) {
+            puts("--headless expects WIDTHxHEIGHT");
+            exit(1);
+        }
+        headless = new HeadlessBackend(width, height);
+        vterm.backend.reset(headless);
+        snapshot_path = arg_result["snapshot"].as<std::string>();
+    }
+    vterm.refresher.latency_ms = arg_result["latency"].as<int>();
+    vterm.refresher.flash_every = arg_result["flash-every"].as<int>();
+    vterm.scrollback.max_bytes = arg_result["scrollback"].as<size_t>() * 1024u * 1024u;
     vterm.setup(arg_result["fontsize"].as<uint8_t>(), fontname.c_str());
     bool reinit_on_damage = false;
     if (!arg_result["no-reinit"].as<bool>()) {
         reinit_on_damage = true;
     }
-    inputs.add_progout(pty.master);
-    if (arg_result["serial"].as<bool>()) {
+    std::string record_path = arg_result["record"].as<std::string>();
+    if (record_path.length() > 0) {
+        recorder.open(record_path.c_str(), static_cast<int>(vterm.nrows()), static_cast<int>(vterm.ncols()));
+    }
+    std::string trace_path = arg_result["trace"].as<std::string>();
+    if (trace_path.length() > 0) {
+        vterm.trace.open(trace_path.c_str());
+    }
+    if (replaying) {
+        replay.speed = arg_result["replay-speed"].as<double>();
+        replay.load(replay_path.c_str());
+        if (replay.rows != static_cast<int>(vterm.nrows()) || replay.cols != static_cast<int>(vterm.ncols())) {
+            printf("--replay: recorded at %dx%d, replaying at %ux%u\n", replay.cols, replay.rows, vterm.ncols(), vterm.nrows());
+        }
+        inputs.add_replay(&replay);
+    } else {
+        inputs.add_progout(pty.master);
+    }
+    if (arg_result["serial"].as<bool>() && !replaying) {
         if (inputs.add_serial()) {
-            deque_printf(buffers.vt100_in, "reading from serial\r\n", GITHASH);
+            ring_printf(buffers.vt100_in, "reading from serial\r\n", GITHASH);
         }
     }
-    inputs.add_ttyraw();
-    if (!arg_result["no-signals"].as<bool>()) {
+    if (!replaying) {
+        inputs.add_ttyraw();
+    }
+    if (!arg_result["no-signals"].as<bool>() && !replaying) {
         inputs.add_signals();
     }
-    if (!arg_result["no-http"].as<bool>()) {
+    if (!arg_result["no-http"].as<bool>() && !replaying) {
         if (inputs.add_http(7800) < 0) {
-            deque_printf(buffers.vt100_in, "http server setup failed\r\n", GITHASH);
+            ring_printf(buffers.vt100_in, "http server setup failed\r\n", GITHASH);
         }
     }
-    inputs.add_vterm_timer(vterm.timerfd, &vterm);
+    inputs.add_frame_timer(vterm.frame_timerfd, &vterm);
+    inputs.add_panel(&vterm);
+    inputs.add_render(&vterm);
     atexit(handle_atexit);
-    pty.set_size(vterm.nrows(), vterm.ncols());
-    deque_printf(buffers.vt100_in, "inkvt\r\nversion %s\r\n", GITHASH);
+    if (!replaying) {
+        pty.set_size(vterm.nrows(), vterm.ncols());
+        ring_printf(buffers.vt100_in, "inkvt\r\nversion %s\r\n", GITHASH);
+    }
     if (inputs.is_listening_on_http()) {
         print_listen_adresses(buffers);
     }
-    if (!arg_result["no-timeout"].as<bool>()) {
+    if (!arg_result["no-timeout"].as<bool>() && !replaying) {
         int seconds = 20;
         inputs.add_exit_after(seconds);
-        deque_printf(buffers.vt100_in, "waiting %d seconds on input\r\n", seconds);
+        ring_printf(buffers.vt100_in, "waiting %d seconds on input\r\n", seconds);
     }
     if (debug) {
-        deque_printf(buffers.vt100_in,
+        ring_printf(buffers.vt100_in,
         "FBInk %s\r\nview %ux%u dev %s/%s/%s/%hu offset %hhu/%hhu/%hhu rota %hhu/%hhu/%d/%hhu/%d\r\n",
             fbink_version(),
             vterm.state.view_width,
@@ -167,7 +248,7 @@ int main(int argc, char ** argv) {
     for (;;) {
         inputs.wait(buffers);
         if (reinit_on_damage) {
-            if (vterm.reinit()) {
+            if (vterm.reinit() && !replaying) {
                 pty.set_size(vterm.nrows(), vterm.ncols());
             }
         }
@@ -195,17 +276,14 @@ int main(int argc, char ** argv) {
                 if (debug) {
                     printf("input touch @ (%d, %d) => (%d, %d)\n", inputs.istate.x, inputs.istate.y, x, y);
                 }
+                recorder.touch(x, y);
                 const char * kb = vterm.click(x, y);
                 for (size_t i = 0u; i < strlen(kb); i++) {
                     buffers.keyboard.push_back(kb[i]);
                 }
+                vterm.trace.arrived(TRACE_OSK, strlen(kb));
             }
         }
-        while (buffers.serial.size() > 0) {
-            char c = buffers.serial.front();
-            buffers.serial.pop_front();
-            buffers.keyboard.push_back(c);
-        }
         while (buffers.scancodes.size() > 0) {
             int c = buffers.scancodes.front();
             buffers.scancodes.pop_front();
@@ -217,19 +295,72 @@ int main(int argc, char ** argv) {
                 keytrans.release(c & 0xff, buffers.keyboard);
             }
         }
-        while (buffers.keyboard.size() > 0) {
+        if (buffers.keyboard.size() > 0) {
             inputs.had_input = 1;
-            char c = buffers.keyboard.front();
-            buffers.keyboard.pop_front();
-            if (keytrans.is_ctrl()) {
-                c = c & 31;
+            recorder.keys(buffers.keyboard);
+            if (vterm.searching) {
+                vterm.search_keys(buffers.keyboard);
+                if (buffers.keyboard.empty()) {
+                    vterm.trace.discard();
+                }
+            }
+            // Typing goes back to the live screen
+            if (buffers.keyboard.size() > 0) {
+                vterm.end_search();
+                vterm.scroll_to(0);
+            }
+        }
+        // So does serial input and pasting, they skip the keyboard queue
+        if (!buffers.typed_direct.empty()) {
+            recorder.direct(buffers.typed_direct);
+            buffers.typed_direct.clear();
+            vterm.end_search();
+            vterm.scroll_to(0);
+        }
+        // Queue as much keyboard input as fits, the rest waits in buffers.keyboard until the shell catches up
+        bool sent_keys = false;
+        while (buffers.keyboard.size() > 0) {
+            RingBuffer::Span span = buffers.pty_out.write_span();
+            size_t n = std::min(span.size, buffers.keyboard.size());
+            if (n == 0) break;
+            for (size_t i = 0u; i < n; i++) {
+                char c = buffers.keyboard[i];
+                if (keytrans.is_ctrl()) {
+                    c = c & 31;
+                }
+                span.data[i] = c;
+            }
+            buffers.keyboard.erase(buffers.keyboard.begin(), buffers.keyboard.begin() + static_cast<long>(n));
+            buffers.pty_out.commit(n);
+            sent_keys = true;
+        }
+        recorder.keys_recorded = buffers.keyboard.size();
+        while (!buffers.vt100_in.empty()) {
+            RingBuffer::Span span = buffers.vt100_in.read_span();
+            recorder.output(span.data, span.size);
+            vterm.write(span.data, span.size);
+            buffers.vt100_in.consume(span.size);
+        }
+        // Output that was read already is no answer to these keys yet
+        if (sent_keys) {
+            vterm.metrics.input();
+        }
+        // Replies to the program's queries (e.g., cursor position reports)
+        buffers.pty_out.fill([](char * dst, size_t n) { return vterm_output_read(vterm.term, dst, n); });
+        if (replaying) {
+            // Nobody to send keys and replies to
+            buffers.pty_out.consume(buffers.pty_out.size());
+        } else if (!buffers.pty_out.empty()) {
+            pty.flush(buffers.pty_out);
+            if (buffers.pty_out.empty()) {
+                vterm.trace.written();
             }
-            pty.write(c);
         }
-        while (buffers.vt100_in.size() > 0) {
-            char c = buffers.vt100_in.front();
-            buffers.vt100_in.pop_front();
-            vterm.write(c);
+        vterm.render();
+        if (replaying && replay.done() && vterm.idle()) {
+            vterm.renderer.stop();
+            replay.report(vterm.backend->stats);
+            exit(0);
         }
     }
 }
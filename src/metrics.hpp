@@ -0,0 +1,142 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <utility>
+
+#include "input_stats.hpp"
+
+// Metrics are written in the Prometheus text format, for GET /metrics and SIGUSR1
+
+static void metric(std::string & out, const char * name, const char * type, const char * help, uint64_t value) {
+    char buf[512];
+    snprintf(buf, sizeof(buf), "# HELP %s %s\n# TYPE %s %s\n%s %llu\n", name, help, name, type, name, static_cast<unsigned long long>(value));
+    out += buf;
+}
+
+static void metric_seconds(std::string & out, const char * name, const char * help, uint64_t us) {
+    char buf[512];
+    snprintf(buf, sizeof(buf), "# HELP %s %s\n# TYPE %s counter\n%s %.6f\n", name, help, name, name, static_cast<double>(us) / 1e6);
+    out += buf;
+}
+
+// buckets of a Histogram, the last one holds up to 2^(n-1) us (~8 s)
+constexpr int HISTOGRAM_BUCKETS = 24;
+
+// Durations in power of two buckets: bucket i counts the ones of at most 2^i us
+struct Histogram {
+    uint64_t buckets[HISTOGRAM_BUCKETS] = {};
+    uint64_t count = 0u;
+    uint64_t sum_us = 0u;
+
+    void add(long us) {
+        us = std::max(us, 0L);
+        int i = us <= 1 ? 0 : 64 - __builtin_clzll(static_cast<unsigned long long>(us - 1));
+        if (i < HISTOGRAM_BUCKETS) {
+            buckets[i] += 1u;
+        }
+        count += 1u;
+        sum_us += static_cast<uint64_t>(us);
+    }
+
+    void print(std::string & out, const char * name, const char * help) const {
+        char buf[512];
+        snprintf(buf, sizeof(buf), "# HELP %s %s\n# TYPE %s histogram\n", name, help, name);
+        out += buf;
+        uint64_t cumulative = 0u;
+        for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+            cumulative += buckets[i];
+            snprintf(buf, sizeof(buf), "%s_bucket{le=\"%g\"} %llu\n", name, static_cast<double>(1L << i) / 1e6, static_cast<unsigned long long>(cumulative));
+            out += buf;
+        }
+        snprintf(buf, sizeof(buf), "%s_bucket{le=\"+Inf\"} %llu\n%s_sum %.6f\n%s_count %llu\n",
+                name, static_cast<unsigned long long>(count),
+                name, static_cast<double>(sum_us) / 1e6,
+                name, static_cast<unsigned long long>(count));
+        out += buf;
+    }
+};
+
+// What VTermToFBInk spends its time on. Drawing, moving and refreshing are the FBInk side, on the render thread.
+struct RenderMetrics {
+    uint64_t bytes_parsed = 0u;
+    uint64_t write_us = 0u;
+    // cells whose pixels changed, and damaged cells that turned out to look the same
+    uint64_t cells_drawn = 0u;
+    uint64_t cells_unchanged = 0u;
+    uint64_t glyph_hits = 0u;
+    uint64_t draw_us = 0u;
+    uint64_t move_us = 0u;
+    uint64_t refresh_us = 0u;
+    // flushing libvterm's damage and reading it for the render thread
+    Histogram frame_time;
+    // from keys going to the program until the first refresh of output that came after them
+    Histogram input_to_refresh;
+    long input_us = -1;
+    bool input_answered = false;
+    // the first frame with the answer
+    uint64_t input_frame = 0u;
+
+    void input() {
+        if (input_us == -1) {
+            input_us = monotonic_us();
+            input_answered = false;
+            input_frame = 0u;
+        }
+    }
+
+    void print(std::string & out) const {
+        metric(out, "inkvt_parsed_bytes_total", "counter", "Bytes passed to vterm_input_write()", bytes_parsed);
+        metric_seconds(out, "inkvt_parse_seconds_total", "Time spent in vterm_input_write()", write_us);
+        metric(out, "inkvt_cells_drawn_total", "counter", "Cells drawn to the framebuffer", cells_drawn);
+        metric(out, "inkvt_cells_unchanged_total", "counter", "Damaged cells that were already on screen as they are", cells_unchanged);
+        metric(out, "inkvt_glyph_cache_hits_total", "counter", "Cells copied from the glyph cache instead of drawn by FBInk", glyph_hits);
+        metric_seconds(out, "inkvt_draw_seconds_total", "Time spent drawing cells", draw_us);
+        metric_seconds(out, "inkvt_move_seconds_total", "Time spent moving pixels for scrolls", move_us);
+        metric_seconds(out, "inkvt_refresh_seconds_total", "Time spent submitting refreshes", refresh_us);
+        frame_time.print(out, "inkvt_frame_seconds", "Time to flush libvterm's damage and read it for the render thread, per frame");
+        input_to_refresh.print(out, "inkvt_input_to_refresh_seconds", "From keys sent to the program to the first refresh of its answer");
+    }
+};
+
+// Counters of the input sources, labeled by source
+static void input_metrics(std::string & out, std::initializer_list<std::pair<const char *, const InputStats *>> sources) {
+    char buf[512];
+    const char * names[] = { "inkvt_input_bytes_total", "inkvt_input_reads_total", "inkvt_input_deliveries_total", "inkvt_input_delivery_seconds_total" };
+    const char * helps[] = { "Bytes read", "Reads", "Times everything read was handed to the shell", "Time from a read until it was handed to the shell" };
+    for (int i = 0; i < 4; i++) {
+        snprintf(buf, sizeof(buf), "# HELP %s %s\n# TYPE %s counter\n", names[i], helps[i], names[i]);
+        out += buf;
+        for (const auto & source : sources) {
+            const InputStats & stats = *source.second;
+            if (i == 3) {
+                snprintf(buf, sizeof(buf), "%s{source=\"%s\"} %.6f\n", names[i], source.first, static_cast<double>(stats.latency_sum_us) / 1e6);
+            } else {
+                uint64_t value = i == 0 ? stats.bytes : i == 1 ? stats.reads : stats.deliveries;
+                snprintf(buf, sizeof(buf), "%s{source=\"%s\"} %llu\n", names[i], source.first, static_cast<unsigned long long>(value));
+            }
+            out += buf;
+        }
+    }
+}
@@ -2,6 +2,7 @@
 
 #include "../FBInk/fbink.h"
 #include "_kblayout.hpp"
+#include "render_backend.hpp"
 
 void osk_setup(unsigned int width, unsigned int height) {
     unsigned int blockw = width / OSK_W;
@@ -20,7 +21,7 @@ void osk_setup(unsigned int width, unsigned int height) {
     }
 }
 
-void osk_render(int fd, FBInkConfig * config, unsigned int osk_y, unsigned int width, unsigned int height) {
+void osk_render(RenderBackend * backend, FBInkConfig * config, unsigned int osk_y, unsigned int width, unsigned int height) {
     unsigned int blockw = width / OSK_W;
     unsigned int blockh = height / OSK_H;
     short cfg_row = config->row;
@@ -33,8 +34,7 @@ void osk_render(int fd, FBInkConfig * config, unsigned int osk_y, unsigned int w
         unsigned int x = static_cast<unsigned int>(osk_keys[i].x * static_cast<float>(blockw));
         unsigned int y = static_cast<unsigned int>(osk_keys[i].y * static_cast<float>(blockh));
         // printf("%u %u %u %u %u\n", i, x, y, osk_keys[i].rrect.width, osk_keys[i].rrect.height);
-        fbink_print_raw_data(
-                fd,
+        backend->print_raw_data(
                 osk_keys[i].rrect.dst,
                 osk_keys[i].rrect.width,
                 osk_keys[i].rrect.height,
@@ -43,11 +43,13 @@ void osk_render(int fd, FBInkConfig * config, unsigned int osk_y, unsigned int w
                 static_cast<short int>(osk_y + y),
                 config
                 );
+        backend->stats.pixels_written += osk_keys[i].rrect.width * osk_keys[i].rrect.height;
     }
     config->no_refresh = false;
-    // Refresh it and make sure it won't be merged
-    fbink_refresh(fd, osk_y, 0u, width, height, config);
-    fbink_wait_for_complete(fd, LAST_MARKER);
+    // Refresh it, the caller holds off its own refreshes until this one is complete so it won't be merged
+    backend->refresh(osk_y, 0u, width, height, config);
+    backend->stats.refreshes += 1u;
+    backend->stats.refresh_area += static_cast<uint64_t>(width) * height;
     config->row = cfg_row;
     config->col = cfg_col;
 }
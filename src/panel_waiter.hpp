@@ -0,0 +1,118 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "input_stats.hpp"
+#include "render_backend.hpp"
+
+struct PanelCompletion {
+    uint32_t marker;
+    long done_us;
+};
+
+// Waits for the panel to complete updates on a helper thread, so the main loop never blocks on the EPDC.
+// Completions come back in the order the markers were handed to wait_for(): eventfd becomes readable, take() has them.
+class PanelWaiter {
+    RenderBackend * backend = nullptr;
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<uint32_t> queued;
+    std::vector<PanelCompletion> completed;
+    bool stopping = false;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [this] { return stopping || !queued.empty(); });
+            if (stopping) return;
+            uint32_t marker = queued.front();
+            lock.unlock();
+            backend->wait_for_complete(marker);
+            long now = monotonic_us();
+            lock.lock();
+            queued.pop_front();
+            completed.push_back({ marker, now });
+            uint64_t one = 1u;
+            if (write(eventfd, &one, sizeof(one)) != sizeof(one)) {
+                perror("PanelWaiter:write");
+            }
+        }
+    }
+
+public:
+    int eventfd = -1;
+
+    ~PanelWaiter() {
+        stop();
+    }
+
+    void start(RenderBackend * b) {
+        backend = b;
+        eventfd = ::eventfd(0u, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (eventfd == -1) {
+            perror("eventfd");
+            exit(1);
+        }
+        // Signals are for the main loop's signalfd, the thread starts with all of them blocked
+        sigset_t all, old;
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        thread = std::thread(&PanelWaiter::run, this);
+        pthread_sigmask(SIG_SETMASK, &old, nullptr);
+    }
+
+    void wait_for(uint32_t marker) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queued.push_back(marker);
+        wake.notify_one();
+    }
+
+    // The updates that completed since the last call
+    std::vector<PanelCompletion> take() {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<PanelCompletion> done;
+        done.swap(completed);
+        return done;
+    }
+
+    // Finishes the wait in progress, if any
+    void stop() {
+        if (!thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+            wake.notify_one();
+        }
+        thread.join();
+    }
+};
@@ -12,6 +12,8 @@
 #include <sys/select.h>
 #include <sys/wait.h>
 
+#include "buffers.hpp"
+
 extern char **environ;
 
 class PseudoTTY {
@@ -25,9 +27,11 @@ public:
         (void)nwritten;
     }
 
-    void write(char c) {
-        int nwritten = ::write(master, &c, 1);
-        (void)nwritten;
+    // Writes as much of out as the pty takes right now, Inputs sends the rest once the master is writable
+    void flush(RingBuffer & out) {
+        if (!out.write_to(master)) {
+            perror("pty write");
+        }
     }
 
     void set_size(int rows, int cols) {
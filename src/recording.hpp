@@ -0,0 +1,215 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/timerfd.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "buffers.hpp"
+#include "input_stats.hpp"
+#include "render_backend.hpp"
+#include "vterm.hpp"
+
+// A recording is a header line, "inkvt-recording 1 <rows> <cols>\n", and then records of
+// a type byte, the time since the start (uint64_t, us), the payload size (uint32_t) and the payload.
+// Numbers are in host byte order.
+enum RecordType : char {
+    RECORD_OUTPUT = 'o', // bytes that went to libvterm
+    RECORD_KEYS = 'k',   // bytes of the keyboard queue: evdev, OSK, HTTP keys and stdin
+    RECORD_TOUCH = 't',  // a tap handed to VTermToFBInk::click(), as two int32_t
+    RECORD_DIRECT = 'd', // serial input and pastes, which skip the keyboard queue (without paste markers)
+};
+
+// Writes what --record logs
+class Recorder {
+    FILE * file = nullptr;
+    long start_us = 0;
+
+    void record(RecordType type, const void * data, size_t len) {
+        if (!file) return;
+        uint64_t t = static_cast<uint64_t>(monotonic_us() - start_us);
+        uint32_t n = static_cast<uint32_t>(len);
+        fputc(type, file);
+        fwrite(&t, sizeof(t), 1u, file);
+        fwrite(&n, sizeof(n), 1u, file);
+        fwrite(data, 1u, len, file);
+    }
+
+public:
+    // the first keys in Buffers::keyboard that are already in the recording
+    size_t keys_recorded = 0u;
+
+    void open(const char * path, int rows, int cols) {
+        file = fopen(path, "wb");
+        if (!file) {
+            perror("--record");
+            exit(1);
+        }
+        fprintf(file, "inkvt-recording 1 %d %d\n", rows, cols);
+        start_us = monotonic_us();
+    }
+
+    bool is_open() const {
+        return file != nullptr;
+    }
+
+    void output(const char * data, size_t len) {
+        record(RECORD_OUTPUT, data, len);
+    }
+
+    // Records the keys that were queued since the last call
+    void keys(const std::deque<char> & keyboard) {
+        if (!file || keyboard.size() <= keys_recorded) return;
+        std::string bytes(keyboard.begin() + static_cast<long>(keys_recorded), keyboard.end());
+        record(RECORD_KEYS, bytes.data(), bytes.size());
+        keys_recorded = keyboard.size();
+    }
+
+    void direct(const std::string & bytes) {
+        record(RECORD_DIRECT, bytes.data(), bytes.size());
+    }
+
+    void touch(int32_t x, int32_t y) {
+        int32_t xy[2] = { x, y };
+        record(RECORD_TOUCH, xy, sizeof(xy));
+    }
+
+    void close() {
+        if (file) fclose(file);
+        file = nullptr;
+    }
+};
+
+// Feeds a recording back into the main loop for --replay, paced by a timerfd
+class Replay {
+    struct Record {
+        RecordType type;
+        long t_us;
+        std::string data;
+    };
+    std::vector<Record> records;
+    size_t next = 0u;
+    // how far into the current output record vt100_in got
+    size_t next_offset = 0u;
+    long start_us = -1;
+    uint64_t output_bytes = 0u;
+
+public:
+    // 1 replays at the recorded pace, 2 twice as fast, 0 as fast as the pipeline goes
+    double speed = 1.0;
+    int rows = 0;
+    int cols = 0;
+    int timerfd = -1;
+
+    void load(const char * path) {
+        FILE * file = fopen(path, "rb");
+        if (!file) {
+            perror("--replay");
+            exit(1);
+        }
+        if (fscanf(file, "inkvt-recording 1 %d %d", &rows, &cols) != 2 || fgetc(file) != '\n') {
+            printf("--replay: %s is not an inkvt recording\n", path);
+            exit(1);
+        }
+        for (;;) {
+            int type = fgetc(file);
+            uint64_t t;
+            uint32_t n;
+            if (type == EOF) break;
+            if (fread(&t, sizeof(t), 1u, file) != 1u || fread(&n, sizeof(n), 1u, file) != 1u) break;
+            Record record = { static_cast<RecordType>(type), static_cast<long>(t), std::string(n, '\0') };
+            if (n > 0u && fread(&record.data[0], 1u, n, file) != n) break;
+            if (record.type == RECORD_OUTPUT) output_bytes += n;
+            records.push_back(std::move(record));
+        }
+        fclose(file);
+        timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (timerfd < 0) {
+            perror("--replay:timerfd_create");
+            exit(1);
+        }
+    }
+
+    bool done() const {
+        return next == records.size();
+    }
+
+    // Hands everything that is due to the main loop: output to vt100_in (as much as fits), keys to
+    // the keyboard queue, serial input and pastes to typed_direct, taps to vterm.click() (the keys those make are recorded as keys already).
+    // Then sets the timer for the next record.
+    void feed(Buffers & buffers, VTermToFBInk & vterm) {
+        long now = monotonic_us();
+        if (start_us == -1) start_us = now;
+        while (next < records.size()) {
+            const Record & record = records[next];
+            long due = speed > 0.0 ? start_us + static_cast<long>(static_cast<double>(record.t_us) / speed) : now;
+            if (due > now) {
+                arm(due - now);
+                return;
+            }
+            if (record.type == RECORD_OUTPUT) {
+                next_offset += buffers.vt100_in.write(record.data.data() + next_offset, record.data.size() - next_offset);
+                if (next_offset < record.data.size()) {
+                    // Again once the main loop drained vt100_in
+                    arm(1);
+                    return;
+                }
+                next_offset = 0u;
+            } else if (record.type == RECORD_KEYS) {
+                buffers.keyboard.insert(buffers.keyboard.end(), record.data.begin(), record.data.end());
+            } else if (record.type == RECORD_DIRECT) {
+                // Nothing reads the pty while replaying, only what it does to the view matters
+                buffers.typed_direct += record.data;
+            } else if (record.type == RECORD_TOUCH && record.data.size() == 2u * sizeof(int32_t)) {
+                int32_t xy[2];
+                memcpy(xy, record.data.data(), sizeof(xy));
+                vterm.click(xy[0], xy[1]);
+            }
+            next++;
+        }
+    }
+
+    void arm(long us) {
+        itimerspec ts = {};
+        ts.it_value.tv_sec = us / 1000000L;
+        ts.it_value.tv_nsec = (us % 1000000L) * 1000L;
+        timerfd_settime(timerfd, 0, &ts, 0);
+    }
+
+    void report(const RenderStats & stats) const {
+        double recorded = records.empty() ? 0.0 : static_cast<double>(records.back().t_us) / 1e6;
+        double wall = static_cast<double>(monotonic_us() - start_us) / 1e6;
+        printf("replay: %zu records, %llu bytes of output, recorded in %.3f s, replayed in %.3f s, "
+               "%llu frames, %llu refreshes, refresh area %llu px, pixels written %llu\n",
+                records.size(),
+                static_cast<unsigned long long>(output_bytes),
+                recorded,
+                wall,
+                static_cast<unsigned long long>(stats.frames),
+                static_cast<unsigned long long>(stats.refreshes),
+                static_cast<unsigned long long>(stats.refresh_area),
+                static_cast<unsigned long long>(stats.pixels_written));
+    }
+};
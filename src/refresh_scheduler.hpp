@@ -0,0 +1,169 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <time.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../libvterm/include/vterm.h"
+#include "./render_backend.hpp"
+
+// default for --latency: while output keeps coming, frames (and their refreshes) are at least <n> ms apart
+constexpr int REFRESH_LATENCY_MS = 50;
+// after <n> ms without refreshes, the screen counts as settled:
+// large updates get GC16 right away, and fast updates since the last GC16 get cleaned up with one
+constexpr int REFRESH_SETTLE_MS = 750;
+// default for --flash-every: flash the whole screen after <n> fast refreshes, to get rid of ghosting
+constexpr int REFRESH_FLASH_EVERY = 64;
+// refreshes at most <n> rows high are typing/cursor updates, and use the fast waveform
+constexpr int REFRESH_TYPING_ROWS = 2;
+// merge everything into one rect beyond <n> pending rects
+constexpr size_t REFRESH_MAX_RECTS = 8u;
+
+static long monotonic_ms() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000L + ts.tv_nsec / 1000000L;
+}
+
+// Coalesces damaged cell rects into as few refreshes as possible,
+// and picks the waveform of every refresh:
+//  - DU for small (typing, cursor) updates
+//  - GL16 for large updates while output is streaming
+//  - GC16 for large updates on a settled screen, and to clean up after the fast ones
+//  - a flashing GC16 of the full screen every flash_every fast refreshes
+class RefreshScheduler {
+    std::vector<VTermRect> pending;
+    // everything refreshed with a fast waveform since the last GC16
+    VTermRect unclean = { 0, 0, 0, 0 };
+    bool has_unclean = false;
+    int nfast_since_flash = 0;
+    long last_flush_ms = -REFRESH_SETTLE_MS;
+
+    static bool touches(const VTermRect & a, const VTermRect & b) {
+        return a.start_row <= b.end_row && b.start_row <= a.end_row
+            && a.start_col <= b.end_col && b.start_col <= a.end_col;
+    }
+
+    static void merge(VTermRect & into, const VTermRect & other) {
+        into.start_row = std::min(into.start_row, other.start_row);
+        into.start_col = std::min(into.start_col, other.start_col);
+        into.end_row = std::max(into.end_row, other.end_row);
+        into.end_col = std::max(into.end_col, other.end_col);
+    }
+
+    void submit(RenderBackend * backend, FBInkConfig * config, const FBInkState & state, const VTermRect & rect, WFM_MODE_INDEX_T wfm, bool flashing) {
+        unsigned short int cols = static_cast<unsigned short int>(rect.end_col - rect.start_col);
+        unsigned short int rows = static_cast<unsigned short int>(rect.end_row - rect.start_row);
+        WFM_MODE_INDEX_T cfg_wfm = config->wfm_mode;
+        bool cfg_flashing = config->is_flashing;
+        config->wfm_mode = wfm;
+        config->is_flashing = flashing;
+        config->col = static_cast<short int>(rect.start_col);
+        config->row = static_cast<short int>(rect.start_row);
+        backend->grid_refresh(cols, rows, config);
+        config->wfm_mode = cfg_wfm;
+        config->is_flashing = cfg_flashing;
+        backend->stats.refreshes += 1u;
+        backend->stats.refresh_area += static_cast<uint64_t>(cols) * state.glyph_width * rows * state.glyph_height;
+    }
+
+public:
+    int latency_ms = REFRESH_LATENCY_MS;
+    int settle_ms = REFRESH_SETTLE_MS;
+    int flash_every = REFRESH_FLASH_EVERY;
+
+    // Nothing left to refresh, not even a settling GC16
+    bool idle() const {
+        return pending.empty() && !has_unclean;
+    }
+
+    void add(const VTermRect & rect) {
+        if (rect.start_row >= rect.end_row || rect.start_col >= rect.end_col) return;
+        VTermRect r = rect;
+        // Swallow every pending rect that overlaps or borders the new one
+        for (size_t i = 0u; i < pending.size();) {
+            if (touches(pending[i], r)) {
+                merge(r, pending[i]);
+                pending[i] = pending.back();
+                pending.pop_back();
+                i = 0u;
+            } else {
+                i++;
+            }
+        }
+        pending.push_back(r);
+        if (pending.size() > REFRESH_MAX_RECTS) {
+            for (size_t i = 1u; i < pending.size(); i++) {
+                merge(pending[0], pending[i]);
+            }
+            pending.resize(1u);
+        }
+    }
+
+    // Refreshes whatever is due, full is the whole terminal area.
+    // Returns the number of ms until it needs to be called again, or -1 when there is nothing left to do.
+    long run(RenderBackend * backend, FBInkConfig * config, const FBInkState & state, const VTermRect & full) {
+        long now = monotonic_ms();
+        long since_flush = now - last_flush_ms;
+        if (!pending.empty()) {
+            if (since_flush < latency_ms) {
+                return latency_ms - since_flush;
+            }
+            bool settled = since_flush >= settle_ms;
+            for (const VTermRect & rect : pending) {
+                if (rect.end_row - rect.start_row <= REFRESH_TYPING_ROWS) {
+                    submit(backend, config, state, rect, WFM_DU, false);
+                } else if (settled) {
+                    submit(backend, config, state, rect, WFM_GC16, false);
+                    continue;
+                } else {
+                    submit(backend, config, state, rect, WFM_GL16, false);
+                }
+                nfast_since_flash += 1;
+                if (has_unclean) {
+                    merge(unclean, rect);
+                } else {
+                    unclean = rect;
+                    has_unclean = true;
+                }
+            }
+            pending.clear();
+            last_flush_ms = now;
+            return has_unclean ? settle_ms : -1;
+        }
+        if (!has_unclean) {
+            return -1;
+        }
+        if (since_flush < settle_ms) {
+            return settle_ms - since_flush;
+        }
+        // Settled: one GC16 over everything that got a fast refresh, or a full flash now and then
+        if (flash_every > 0 && nfast_since_flash >= flash_every) {
+            submit(backend, config, state, full, WFM_GC16, true);
+            nfast_since_flash = 0;
+        } else {
+            submit(backend, config, state, unclean, WFM_GC16, false);
+        }
+        has_unclean = false;
+        last_flush_ms = now;
+        return -1;
+    }
+};
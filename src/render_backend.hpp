@@ -0,0 +1,128 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../FBInk/fbink.h"
+
+// Filled in by the callers of a RenderBackend, so every backend is accounted the same way
+struct RenderStats {
+    uint64_t frames = 0u;
+    uint64_t pixels_written = 0u;
+    uint64_t refreshes = 0u;
+    uint64_t refresh_area = 0u; // in pixels
+};
+
+// Everything VTermToFBInk needs from a display.
+// FBInkConfig and FBInkState are used as the common vocabulary, whatever the backend:
+// row/col in the config address grid cells, the state describes the grid and the pixel layout.
+class RenderBackend {
+public:
+    RenderStats stats;
+
+    virtual ~RenderBackend() {}
+
+    // Applies the font settings in config and fills in state, false on failure
+    virtual bool open(FBInkConfig * config, FBInkState * state) = 0;
+    // Same return value as fbink_reinit(), state is refreshed when something changed
+    virtual int reinit(FBInkConfig * config, FBInkState * state) = 0;
+    // Directly addressable pixels (layout in FBInkState), nullptr if unsupported
+    virtual uint8_t * framebuffer(size_t * size) = 0;
+    virtual void cls(const FBInkConfig * config) = 0;
+    // Draw text in 0xRRGGBB colors at config->row/col
+    virtual void print(const char * text, uint32_t fg, uint32_t bg, const FBInkConfig * config) = 0;
+    virtual void grid_clear(unsigned short int cols, unsigned short int rows, uint32_t bg, const FBInkConfig * config) = 0;
+    // Same arguments as fbink_print_raw_data()
+    virtual void print_raw_data(const uint8_t * data, int w, int h, size_t len, short int x, short int y, const FBInkConfig * config) = 0;
+    virtual void grid_refresh(unsigned short int cols, unsigned short int rows, const FBInkConfig * config) = 0;
+    virtual void refresh(uint32_t top, uint32_t left, uint32_t width, uint32_t height, const FBInkConfig * config) = 0;
+    // The update marker of the last refresh
+    virtual uint32_t last_marker() = 0;
+    // Blocks until the panel finished the update with that marker, LAST_MARKER for the last one
+    virtual void wait_for_complete(uint32_t marker) = 0;
+};
+
+class FBInkBackend : public RenderBackend {
+    static void set_pens(uint32_t fg, uint32_t bg) {
+        fbink_set_fg_pen_rgba(static_cast<uint8_t>(fg >> 16), static_cast<uint8_t>(fg >> 8), static_cast<uint8_t>(fg), 0xFFu, false, true);
+        fbink_set_bg_pen_rgba(static_cast<uint8_t>(bg >> 16), static_cast<uint8_t>(bg >> 8), static_cast<uint8_t>(bg), 0xFFu, false, true);
+    }
+public:
+    int fbfd = -1;
+
+    bool open(FBInkConfig * config, FBInkState * state) override {
+        fbfd = fbink_open();
+        if (fbfd == -1) {
+            puts("fbink_open()");
+            return false;
+        }
+        fbink_init(fbfd, config);
+        fbink_cls(fbfd, config, nullptr, false);
+        fbink_get_state(config, state);
+        return true;
+    }
+
+    int reinit(FBInkConfig * config, FBInkState * state) override {
+        int res = fbink_reinit(fbfd, config);
+        if (res > EXIT_SUCCESS) {
+            fbink_get_state(config, state);
+        }
+        return res;
+    }
+
+    uint8_t * framebuffer(size_t * size) override {
+        return fbink_get_fb_pointer(fbfd, size);
+    }
+
+    void cls(const FBInkConfig * config) override {
+        fbink_cls(fbfd, config, nullptr, false);
+    }
+
+    void print(const char * text, uint32_t fg, uint32_t bg, const FBInkConfig * config) override {
+        set_pens(fg, bg);
+        fbink_print(fbfd, text, config);
+    }
+
+    void grid_clear(unsigned short int cols, unsigned short int rows, uint32_t bg, const FBInkConfig * config) override {
+        set_pens(bg, bg);
+        fbink_grid_clear(fbfd, cols, rows, config);
+    }
+
+    void print_raw_data(const uint8_t * data, int w, int h, size_t len, short int x, short int y, const FBInkConfig * config) override {
+        fbink_print_raw_data(fbfd, data, w, h, len, x, y, config);
+    }
+
+    void grid_refresh(unsigned short int cols, unsigned short int rows, const FBInkConfig * config) override {
+        fbink_grid_refresh(fbfd, cols, rows, config);
+    }
+
+    void refresh(uint32_t top, uint32_t left, uint32_t width, uint32_t height, const FBInkConfig * config) override {
+        fbink_refresh(fbfd, top, left, width, height, config);
+    }
+
+    uint32_t last_marker() override {
+        return fbink_get_last_marker();
+    }
+
+    void wait_for_complete(uint32_t marker) override {
+        fbink_wait_for_complete(fbfd, marker);
+    }
+};
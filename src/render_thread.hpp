@@ -0,0 +1,174 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../libvterm/include/vterm.h"
+#include "./glyph_cache.hpp"
+
+// A damaged cell, as the main thread read it from libvterm
+struct FrameCell {
+    GlyphKey key;
+    // plain single width, single codepoint cells fit a glyph cache slot
+    bool cacheable;
+    // its UTF-8 in Frame::text, empty for blank cells
+    uint32_t text_offset;
+    uint32_t text_len;
+};
+
+// Damaged columns [col0, col1) of a row, their cells start at Frame::cells[first_cell]
+struct FrameRow {
+    int row;
+    int col0;
+    int col1;
+    size_t first_cell;
+};
+
+// Pixels to move before drawing, for scrolls
+struct FrameMove {
+    VTermRect dst;
+    VTermRect src;
+};
+
+// One frame's worth of damage, handed from the main thread to the render thread.
+// The vectors are reused from frame to frame.
+struct Frame {
+    uint64_t seq = 0u;
+    std::vector<FrameMove> moves;
+    std::vector<FrameRow> rows;
+    std::vector<FrameCell> cells;
+    std::string text;
+
+    void clear() {
+        moves.clear();
+        rows.clear();
+        cells.clear();
+        text.clear();
+    }
+};
+
+// Runs draw() and refresh() on a thread of their own, so a slow frame or refresh doesn't hold up reading the pty.
+// The main thread snapshots the damage into frame and publish()es it, it may fill frame again once can_publish():
+// the handoff itself is a single atomic, the main thread never waits for the render thread to publish.
+// Whatever draw() and refresh() share with the main thread (the backend, what is drawn, their reports)
+// is only touched with mutex held, the render thread holds it while it works.
+// After every wakeup, done_fd becomes readable.
+class RenderThread {
+    enum { FREE, READY };
+    std::atomic<int> slot{FREE};
+    std::atomic<bool> stopping{false};
+    std::thread thread;
+    int wake_fd = -1;
+
+    static void signal(int fd) {
+        uint64_t one = 1u;
+        if (write(fd, &one, sizeof(one)) != sizeof(one)) {
+            perror("RenderThread:write");
+        }
+    }
+
+    void run() {
+        long timeout_ms = -1;
+        for (;;) {
+            pollfd pfd = { wake_fd, POLLIN, 0 };
+            int n = poll(&pfd, 1, static_cast<int>(timeout_ms));
+            if (n > 0) {
+                uint64_t buf;
+                if (read(wake_fd, &buf, sizeof(buf)) < 0 && errno != EAGAIN) {
+                    perror("RenderThread:read");
+                }
+            }
+            if (stopping.load()) return;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (slot.load(std::memory_order_acquire) == READY) {
+                    draw(frame);
+                    slot.store(FREE, std::memory_order_release);
+                }
+                timeout_ms = refresh();
+            }
+            signal(done_fd);
+        }
+    }
+
+public:
+    Frame frame;
+    std::mutex mutex;
+    int done_fd = -1;
+    // Draws a frame, and runs the refreshes that are due, returning the ms until they need to run again or -1
+    std::function<void(const Frame &)> draw;
+    std::function<long()> refresh;
+
+    ~RenderThread() {
+        stop();
+    }
+
+    void start() {
+        wake_fd = eventfd(0u, EFD_NONBLOCK | EFD_CLOEXEC);
+        done_fd = eventfd(0u, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (wake_fd == -1 || done_fd == -1) {
+            perror("eventfd");
+            exit(1);
+        }
+        // Signals are for the main loop's signalfd, the thread starts with all of them blocked
+        sigset_t all, old;
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        thread = std::thread(&RenderThread::run, this);
+        pthread_sigmask(SIG_SETMASK, &old, nullptr);
+    }
+
+    // The main thread may fill frame
+    bool can_publish() const {
+        return slot.load(std::memory_order_acquire) == FREE;
+    }
+
+    void publish() {
+        slot.store(READY, std::memory_order_release);
+        signal(wake_fd);
+    }
+
+    // Runs refresh() again soon, e.g., after the main thread changed what it works with
+    void wake() {
+        signal(wake_fd);
+    }
+
+    // Finishes the frame in progress, if any
+    void stop() {
+        if (!thread.joinable()) return;
+        stopping.store(true);
+        signal(wake_fd);
+        thread.join();
+    }
+};
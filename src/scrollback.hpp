@@ -0,0 +1,427 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../libvterm/include/vterm.h"
+
+// default for --scrollback: keep at most <n> MB of lines that scrolled off the top
+constexpr size_t SCROLLBACK_MB = 4u;
+
+static void put_utf8(std::string & out, uint32_t cp) {
+    if (cp < 0x80u) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800u) {
+        out.push_back(static_cast<char>(0xC0u | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80u | (cp & 0x3Fu)));
+    } else if (cp < 0x10000u) {
+        out.push_back(static_cast<char>(0xE0u | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu)));
+        out.push_back(static_cast<char>(0x80u | (cp & 0x3Fu)));
+    } else {
+        out.push_back(static_cast<char>(0xF0u | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80u | ((cp >> 12) & 0x3Fu)));
+        out.push_back(static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu)));
+        out.push_back(static_cast<char>(0x80u | (cp & 0x3Fu)));
+    }
+}
+
+// Lines that scrolled off the top of the screen, oldest first, fed by libvterm's sb_pushline.
+// Each line is a byte string: cells are UTF-8, with control bytes (which never end up in a cell) for the rest:
+//  - SB_EMPTY: an erased cell
+//  - SB_WIDE: the next cell is double width (libvterm's continuation cell is left out)
+//  - SB_COMBINE: the next codepoint belongs to the previous cell
+//  - SB_REPEAT <n>: the previous cell <n> more times
+//  - SB_PEN <index>: the cells from here on use that pen
+// Pens are shared by all lines. Trailing erased cells with the same pen aren't stored,
+// lines are padded with the last pen to whatever width they are read back at.
+class Scrollback {
+    static constexpr char SB_EMPTY = 0x01;
+    static constexpr char SB_WIDE = 0x02;
+    static constexpr char SB_COMBINE = 0x03;
+    static constexpr char SB_REPEAT = 0x04;
+    static constexpr char SB_PEN = 0x05;
+
+    struct Pen {
+        VTermScreenCellAttrs attrs;
+        VTermColor fg;
+        VTermColor bg;
+        uint32_t refs;
+    };
+
+    // Canonical form of a pen, to compare and hash them
+    struct PenKey {
+        uint32_t fg;
+        uint32_t bg;
+        uint32_t attrs;
+
+        bool operator==(const PenKey & other) const {
+            return fg == other.fg && bg == other.bg && attrs == other.attrs;
+        }
+    };
+
+    struct PenKeyHash {
+        size_t operator()(const PenKey & k) const {
+            uint64_t h = k.fg;
+            h = h * 0x9E3779B97F4A7C15ull ^ k.bg;
+            h = h * 0x9E3779B97F4A7C15ull ^ k.attrs;
+            return static_cast<size_t>(h ^ (h >> 29));
+        }
+    };
+
+    std::deque<std::string> lines;
+    std::vector<Pen> pens;
+    std::unordered_map<PenKey, uint32_t, PenKeyHash> pen_index;
+    // pens no line refers to anymore
+    std::vector<uint32_t> free_pens;
+    size_t used = 0u;
+    // lines dropped to stay under max_bytes, or cleared
+    uint64_t ndropped = 0u;
+
+    static uint32_t color_key(const VTermColor & c) {
+        if (VTERM_COLOR_IS_INDEXED(&c)) {
+            return c.type | static_cast<uint32_t>(c.indexed.idx) << 8;
+        }
+        return c.type | static_cast<uint32_t>(c.rgb.red) << 8 | static_cast<uint32_t>(c.rgb.green) << 16 | static_cast<uint32_t>(c.rgb.blue) << 24;
+    }
+
+    static PenKey pen_key(const VTermScreenCell & cell) {
+        const VTermScreenCellAttrs & a = cell.attrs;
+        return {
+            color_key(cell.fg),
+            color_key(cell.bg),
+            static_cast<uint32_t>(a.bold | a.underline << 1 | a.italic << 3 | a.blink << 4 | a.reverse << 5 | a.conceal << 6
+                | a.strike << 7 | a.font << 8 | a.dwl << 12 | a.dhl << 13 | a.small << 15 | a.baseline << 16),
+        };
+    }
+
+    static bool same_pen(const VTermScreenCell & a, const VTermScreenCell & b) {
+        return pen_key(a) == pen_key(b);
+    }
+
+    static bool same_cell(const VTermScreenCell & a, const VTermScreenCell & b) {
+        if (a.width != b.width || !same_pen(a, b)) return false;
+        for (int i = 0; i < VTERM_MAX_CHARS_PER_CELL; i++) {
+            if (a.chars[i] != b.chars[i]) return false;
+            if (!a.chars[i]) break;
+        }
+        return true;
+    }
+
+    static bool is_empty(const VTermScreenCell & cell) {
+        return cell.chars[0] == 0u;
+    }
+
+    uint32_t ref_pen(const VTermScreenCell & cell) {
+        PenKey key = pen_key(cell);
+        auto it = pen_index.find(key);
+        uint32_t index;
+        if (it != pen_index.end()) {
+            index = it->second;
+        } else {
+            if (free_pens.empty()) {
+                index = static_cast<uint32_t>(pens.size());
+                pens.push_back({});
+                used += sizeof(Pen) + sizeof(PenKey) + sizeof(uint32_t);
+            } else {
+                index = free_pens.back();
+                free_pens.pop_back();
+            }
+            pens[index] = { cell.attrs, cell.fg, cell.bg, 0u };
+            pen_index[key] = index;
+        }
+        pens[index].refs += 1u;
+        return index;
+    }
+
+    void unref_pen(uint32_t index) {
+        Pen & pen = pens[index];
+        if (--pen.refs > 0u) return;
+        VTermScreenCell cell = {};
+        cell.attrs = pen.attrs;
+        cell.fg = pen.fg;
+        cell.bg = pen.bg;
+        pen_index.erase(pen_key(cell));
+        free_pens.push_back(index);
+    }
+
+    static void put_varint(std::string & out, uint32_t v) {
+        while (v >= 0x80u) {
+            out.push_back(static_cast<char>(0x80u | (v & 0x7Fu)));
+            v >>= 7;
+        }
+        out.push_back(static_cast<char>(v));
+    }
+
+    static uint32_t get_varint(const std::string & in, size_t & pos) {
+        uint32_t v = 0u;
+        for (int shift = 0; pos < in.size(); shift += 7) {
+            uint8_t b = static_cast<uint8_t>(in[pos++]);
+            v |= static_cast<uint32_t>(b & 0x7Fu) << shift;
+            if (!(b & 0x80u)) break;
+        }
+        return v;
+    }
+
+    static uint32_t get_utf8(const std::string & in, size_t & pos) {
+        uint8_t b = static_cast<uint8_t>(in[pos++]);
+        int n = b >= 0xF0u ? 3 : b >= 0xE0u ? 2 : b >= 0xC0u ? 1 : 0;
+        uint32_t cp = n == 3 ? b & 0x07u : n == 2 ? b & 0x0Fu : n == 1 ? b & 0x1Fu : b;
+        for (; n > 0 && pos < in.size(); n--) {
+            cp = cp << 6 | (static_cast<uint8_t>(in[pos++]) & 0x3Fu);
+        }
+        return cp;
+    }
+
+    static size_t line_cost(const std::string & line) {
+        // the string's own allocation, and what std::deque and malloc spend on it
+        return line.capacity() + sizeof(std::string) + 16u;
+    }
+
+    std::string encode(int cols, const VTermScreenCell * cells) {
+        // Trailing erased cells with the same pen are implied by the column count
+        int end = cols;
+        while (end > 0 && is_empty(cells[end - 1]) && same_pen(cells[end - 1], cells[cols - 1])) {
+            end--;
+        }
+        std::string out;
+        const VTermScreenCell * pen = nullptr;
+        for (int col = 0; col < end;) {
+            const VTermScreenCell & cell = cells[col];
+            if (!pen || !same_pen(*pen, cell)) {
+                out.push_back(SB_PEN);
+                put_varint(out, ref_pen(cell));
+                pen = &cell;
+            }
+            int width = cell.width == 2 && col + 1 < cols ? 2 : 1;
+            if (is_empty(cell) || cell.chars[0] == static_cast<uint32_t>(-1)) {
+                out.push_back(SB_EMPTY);
+            } else {
+                if (width == 2) {
+                    out.push_back(SB_WIDE);
+                }
+                for (int i = 0; i < VTERM_MAX_CHARS_PER_CELL && cell.chars[i]; i++) {
+                    if (i > 0) {
+                        out.push_back(SB_COMBINE);
+                    }
+                    put_utf8(out, cell.chars[i]);
+                }
+            }
+            int next = col + width;
+            uint32_t repeat = 0u;
+            while (next + width <= end && same_cell(cells[next], cell)) {
+                repeat += 1u;
+                next += width;
+            }
+            if (repeat > 0u) {
+                out.push_back(SB_REPEAT);
+                put_varint(out, repeat);
+            }
+            col = next;
+        }
+        if (end < cols && (!pen || !same_pen(*pen, cells[cols - 1]))) {
+            out.push_back(SB_PEN);
+            put_varint(out, ref_pen(cells[cols - 1]));
+        }
+        out.shrink_to_fit();
+        return out;
+    }
+
+    // Calls f(pen index) for every pen a line refers to
+    template <typename F>
+    static void for_each_pen(const std::string & line, F f) {
+        size_t pos = 0u;
+        while (pos < line.size()) {
+            char c = line[pos++];
+            if (c == SB_PEN) {
+                f(get_varint(line, pos));
+            } else if (c == SB_REPEAT) {
+                get_varint(line, pos);
+            }
+        }
+    }
+
+    void drop_oldest() {
+        for_each_pen(lines.front(), [this](uint32_t index) { unref_pen(index); });
+        used -= line_cost(lines.front());
+        lines.pop_front();
+        ndropped += 1u;
+    }
+
+public:
+    // 0 keeps nothing
+    size_t max_bytes = SCROLLBACK_MB * 1024u * 1024u;
+
+    size_t size() const {
+        return lines.size();
+    }
+
+    size_t bytes() const {
+        return used;
+    }
+
+    // Lines ever pushed, including the ones that were dropped since.
+    // Line i (counting from the oldest that is still there) is line ndropped + i of all of them.
+    uint64_t total() const {
+        return ndropped + lines.size();
+    }
+
+    void push(int cols, const VTermScreenCell * cells) {
+        if (max_bytes == 0u) return;
+        lines.push_back(encode(cols, cells));
+        used += line_cost(lines.back());
+        while (used > max_bytes && !lines.empty()) {
+            drop_oldest();
+        }
+    }
+
+    // Decodes line i into cols cells, cut off or padded with the line's trailing pen
+    void get(size_t i, int cols, VTermScreenCell * cells) const {
+        const std::string & line = lines[i];
+        size_t pos = 0u;
+        VTermScreenCell blank = {};
+        blank.width = 1;
+        VTermScreenCell * last = nullptr;
+        int col = 0;
+        bool wide = false;
+        while (pos < line.size() && col < cols) {
+            char c = line[pos++];
+            if (c == SB_PEN) {
+                const Pen & pen = pens[get_varint(line, pos)];
+                blank.attrs = pen.attrs;
+                blank.fg = pen.fg;
+                blank.bg = pen.bg;
+            } else if (c == SB_WIDE) {
+                wide = true;
+            } else if (c == SB_COMBINE) {
+                uint32_t cp = get_utf8(line, pos);
+                if (last) {
+                    int n = 1;
+                    while (n < VTERM_MAX_CHARS_PER_CELL && last->chars[n]) n++;
+                    if (n < VTERM_MAX_CHARS_PER_CELL) {
+                        last->chars[n] = cp;
+                        if (n + 1 < VTERM_MAX_CHARS_PER_CELL) last->chars[n + 1] = 0u;
+                    }
+                }
+            } else if (c == SB_REPEAT) {
+                uint32_t n = get_varint(line, pos);
+                if (!last) continue;
+                VTermScreenCell copy = *last;
+                for (uint32_t k = 0u; k < n && col < cols; k++) {
+                    cells[col] = copy;
+                    last = &cells[col];
+                    col += 1;
+                    if (copy.width == 2 && col < cols) {
+                        cells[col] = blank;
+                        cells[col].chars[0] = static_cast<uint32_t>(-1);
+                        col += 1;
+                    }
+                }
+            } else {
+                VTermScreenCell & cell = cells[col];
+                cell = blank;
+                if (c != SB_EMPTY) {
+                    pos -= 1u;
+                    cell.chars[0] = get_utf8(line, pos);
+                    cell.chars[1] = 0u;
+                }
+                last = &cell;
+                col += 1;
+                if (wide) {
+                    cell.width = 2;
+                    if (col < cols) {
+                        // What libvterm's own sb_pushline gives for the right half
+                        cells[col] = blank;
+                        cells[col].chars[0] = static_cast<uint32_t>(-1);
+                        col += 1;
+                    }
+                    wide = false;
+                }
+            }
+        }
+        for (; col < cols; col++) {
+            cells[col] = blank;
+        }
+    }
+
+    // Line i as UTF-8 text, erased cells as spaces, without what trails the last character
+    std::string text(size_t i) const {
+        const std::string & line = lines[i];
+        std::string out;
+        // the previous cell's bytes, for SB_REPEAT
+        size_t last = 0u;
+        size_t pos = 0u;
+        while (pos < line.size()) {
+            char c = line[pos++];
+            if (c == SB_PEN) {
+                get_varint(line, pos);
+            } else if (c == SB_WIDE) {
+                continue;
+            } else if (c == SB_COMBINE) {
+                size_t start = pos;
+                get_utf8(line, pos);
+                out.append(line, start, pos - start);
+            } else if (c == SB_REPEAT) {
+                uint32_t n = get_varint(line, pos);
+                std::string cell = out.substr(last);
+                for (uint32_t k = 0u; k < n; k++) {
+                    out += cell;
+                }
+            } else {
+                last = out.size();
+                if (c == SB_EMPTY) {
+                    out.push_back(' ');
+                } else {
+                    pos -= 1u;
+                    size_t start = pos;
+                    get_utf8(line, pos);
+                    out.append(line, start, pos - start);
+                }
+            }
+        }
+        size_t end = out.find_last_not_of(' ');
+        out.resize(end == std::string::npos ? 0u : end + 1u);
+        return out;
+    }
+
+    // The newest line, which is then gone. Returns false if there is none.
+    bool pop(int cols, VTermScreenCell * cells) {
+        if (lines.empty()) return false;
+        get(lines.size() - 1u, cols, cells);
+        for_each_pen(lines.back(), [this](uint32_t index) { unref_pen(index); });
+        used -= line_cost(lines.back());
+        lines.pop_back();
+        return true;
+    }
+
+    void clear() {
+        ndropped += lines.size();
+        lines.clear();
+        pens.clear();
+        pen_index.clear();
+        free_pens.clear();
+        used = 0u;
+    }
+};
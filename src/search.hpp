@@ -0,0 +1,145 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+// lines per block of the search index
+constexpr uint32_t SEARCH_BLOCK_LINES = 64u;
+// bits in a block's trigram signature, ~32 bytes per line
+constexpr uint32_t SEARCH_BLOCK_BITS = 16384u;
+// matches listed for GET /search
+constexpr size_t SEARCH_HTTP_MATCHES = 100u;
+
+// ASCII case folded copy, searches ignore case
+static std::string search_fold(const std::string & text) {
+    std::string out(text);
+    for (char & c : out) {
+        if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+    }
+    return out;
+}
+
+// Which lines of the scrollback may contain a string, kept up to date as lines are pushed.
+// Lines are numbered like Scrollback::total(). Every block of SEARCH_BLOCK_LINES lines has a
+// signature with a bit set for every trigram (hashed) in its lines: a search only reads back
+// the lines of blocks whose signature has all trigrams of the query.
+// Pushing a line sets a few bits, dropping the oldest lines drops whole blocks.
+class SearchIndex {
+    struct Block {
+        uint64_t first;
+        uint32_t count;
+        std::vector<uint64_t> bits;
+    };
+    std::deque<Block> blocks;
+
+    static uint32_t trigram_bit(const char * s) {
+        uint32_t h = static_cast<uint8_t>(s[0]) | static_cast<uint8_t>(s[1]) << 8 | static_cast<uint8_t>(s[2]) << 16;
+        return (h * 0x9E3779B1u) >> (32 - 14);
+    }
+    static_assert(SEARCH_BLOCK_BITS == 1u << 14, "trigram_bit() makes 14 bit indices");
+
+    static bool has_all(const Block & block, const std::vector<uint32_t> & bits) {
+        for (uint32_t bit : bits) {
+            if (!(block.bits[bit / 64u] >> (bit % 64u) & 1u)) return false;
+        }
+        return true;
+    }
+
+    static std::vector<uint32_t> query_bits(const std::string & needle) {
+        std::vector<uint32_t> bits;
+        for (size_t i = 0u; i + 3u <= needle.size(); i++) {
+            bits.push_back(trigram_bit(&needle[i]));
+        }
+        return bits;
+    }
+
+public:
+    // lines that were indexed, text is folded with search_fold()
+    void push(uint64_t line, const std::string & text) {
+        if (blocks.empty() || blocks.back().count == SEARCH_BLOCK_LINES || blocks.back().first + blocks.back().count != line) {
+            blocks.push_back({ line, 0u, std::vector<uint64_t>(SEARCH_BLOCK_BITS / 64u) });
+        }
+        Block & block = blocks.back();
+        for (size_t i = 0u; i + 3u <= text.size(); i++) {
+            uint32_t bit = trigram_bit(&text[i]);
+            block.bits[bit / 64u] |= uint64_t(1u) << (bit % 64u);
+        }
+        block.count += 1u;
+    }
+
+    // The newest line is gone. Its bits stay, they only cost a few extra lines read back.
+    void pop() {
+        if (blocks.empty()) return;
+        if (--blocks.back().count == 0u) {
+            blocks.pop_back();
+        }
+    }
+
+    // Lines before first were dropped
+    void drop_before(uint64_t first) {
+        while (!blocks.empty() && blocks.front().first + blocks.front().count <= first) {
+            blocks.pop_front();
+        }
+    }
+
+    void clear() {
+        blocks.clear();
+    }
+
+    size_t bytes() const {
+        return blocks.size() * (sizeof(Block) + SEARCH_BLOCK_BITS / 8u);
+    }
+
+    // Newest line in [first, before) whose text (from text_of(line), already folded) contains needle, or UINT64_MAX
+    template <typename F>
+    uint64_t find_older(const std::string & needle, uint64_t first, uint64_t before, F text_of) const {
+        std::vector<uint32_t> bits = query_bits(needle);
+        for (auto it = blocks.rbegin(); it != blocks.rend(); ++it) {
+            if (it->first >= before) continue;
+            if (it->first + it->count <= first) break;
+            if (!has_all(*it, bits)) continue;
+            uint64_t line = std::min<uint64_t>(before, it->first + it->count);
+            while (line-- > std::max(it->first, first)) {
+                if (text_of(line).find(needle) != std::string::npos) return line;
+            }
+        }
+        return UINT64_MAX;
+    }
+
+    // Oldest line in [from, end) whose text contains needle, or UINT64_MAX
+    template <typename F>
+    uint64_t find_newer(const std::string & needle, uint64_t from, uint64_t end, F text_of) const {
+        std::vector<uint32_t> bits = query_bits(needle);
+        for (const Block & block : blocks) {
+            if (block.first + block.count <= from) continue;
+            if (block.first >= end) break;
+            if (!has_all(block, bits)) continue;
+            uint64_t stop = std::min<uint64_t>(end, block.first + block.count);
+            for (uint64_t line = std::max(block.first, from); line < stop; line++) {
+                if (text_of(line).find(needle) != std::string::npos) return line;
+            }
+        }
+        return UINT64_MAX;
+    }
+};
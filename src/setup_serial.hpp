@@ -29,8 +29,11 @@ void setup_serial(int fd) {
     tty.c_oflag &= ~ONLCR; // prevent conversion of newline to carriage return/line feed
     // tty.c_oflag &= ~OXTABS; // prevent conversion of tabs to spaces (NOT PRESENT IN LINUX)
     // tty.c_oflag &= ~ONOEOT; // prevent removal of C-d chars (0x004) in output (NOT PRESENT IN LINUX)
-    // tty.c_cc[VTIME] = 0;
-    // tty.c_cc[VMIN] = 0;
+    // VMIN/VTIME don't apply to our O_NONBLOCK fd, every read() returns whatever arrived right away.
+    // Batching comes from epoll instead: one wakeup reads everything queued up since in one chunk,
+    // while an inter-byte VTIME would hold back every single keystroke.
+    tty.c_cc[VTIME] = 0;
+    tty.c_cc[VMIN] = 1;
     cfsetispeed(&tty, B9600);
     cfsetospeed(&tty, B9600);
     if (tcsetattr(fd, TCSANOW, &tty) != 0) {
@@ -18,6 +18,9 @@
 #pragma once
 
 #include <algorithm>
+#include <deque>
+#include <memory>
+#include <vector>
 #include <sys/timerfd.h>
 #include <linux/fb.h>
 #include <iostream>
@@ -27,12 +30,16 @@
 #include "../libvterm/include/vterm.h"
 #include "../FBInk/fbink.h"
 #include "./osk.hpp"
-
-// reset high_throughput_mode check every <n> ms
-constexpr int INTERVAL_MS = 100;
-// after <n> consecutive ticks of the timer without writes
-// disable timer (sleep) mode, to save battery life
-constexpr int TIMER_SLEEP_MODE_THRESHOLD = 10;
+#include "./glyph_cache.hpp"
+#include "./render_backend.hpp"
+#include "./refresh_scheduler.hpp"
+#include "./damage.hpp"
+#include "./scrollback.hpp"
+#include "./search.hpp"
+#include "./metrics.hpp"
+#include "./latency_trace.hpp"
+#include "./panel_waiter.hpp"
+#include "./render_thread.hpp"
 
 class VTermToFBInk {
     RoundedRect cursor;
@@ -47,31 +54,105 @@ public:
     VTermScreen * screen;
     VTermScreenCallbacks vtsc;
 
-    // timer to detect huge output streams
-    long high_throughput_threshold = 100000;
-    int timerfd = -1;
-    long nwrites_in_interval = 0;
-    bool high_throughput_mode = false;
-    VTermPos last_cursor;
-    bool timer_is_running = false;
-    int nticks_without_output = 0;
+    // libvterm callbacks only mark cells dirty here, render() draws them once per frame
+    DamageTracker damage;
+    // What every cell shows on screen right now, so cells that didn't actually change aren't redrawn:
+    // with VTERM_DAMAGE_SCROLL, libvterm only reports the bounding box of everything that changed.
+    std::vector<GlyphKey> drawn;
+    int drawn_cols = 0;
+    // bytes were written to libvterm since its damage was last flushed
+    bool unflushed = false;
+    VTermPos last_cursor = { 0, 0 };
+    // where the cursor was when the last frame was drawn
+    VTermPos drawn_cursor = { 0, 0 };
+
+    // lines that scrolled off the top, and how far back the view is paged into them (0 is live)
+    Scrollback scrollback;
+    int scroll_offset = 0;
+    // the scrollback line last decoded for drawing, by its Scrollback::total() number
+    uint64_t view_line = UINT64_MAX;
+    std::vector<VTermScreenCell> view_cells;
+    // shown in the top right corner while paged back or searching
+    std::string scroll_label;
+
+    // which scrollback lines to read back when searching
+    SearchIndex search;
+    // keys go to search_query instead of the shell, see search_keys()
+    bool searching = false;
+    bool search_failed = false;
+    std::string search_query;
+    // the match shown, highlighted: a line number as in line_text(), and its columns
+    uint64_t match_line = UINT64_MAX;
+    int match_col0 = 0;
+    int match_col1 = 0;
 
     // osk debounce
     timeval osk_last_kp;
     int32_t osk_last_x = -100;
     int32_t osk_last_y = -100;
 
-    itimerspec ts_on;
-    itimerspec ts_off = {};
-    //ts.it_value.tv_nsec = 100*1000000;
-    //ts.it_interval.tv_nsec = 100*1000000;
+    // queues and submits the refreshes of frames, on the render thread
+    RefreshScheduler refresher;
+    RenderMetrics metrics;
+    LatencyTrace trace;
+    // wakes render() up for deferred frames
+    int frame_timerfd = -1;
+    // when the last frame was handed to the render thread, frames are at least refresher.latency_ms apart
+    long last_frame_ms = -REFRESH_SETTLE_MS;
+    uint64_t frame_seq = 0u;
+    // scrolls since the last frame, the render thread moves their pixels before it draws the frame
+    std::vector<FrameMove> moves;
+
+    // The render thread draws frames and submits their refreshes, see render() and draw_frame().
+    // What it did is reported back, guarded by renderer.mutex, and collect()ed by the main thread.
+    RenderThread renderer;
+    struct FrameDrawn {
+        uint64_t seq;
+        long done_us;
+    };
+    struct RefreshSubmitted {
+        // the last frame it shows
+        uint64_t seq;
+        uint32_t marker;
+        long t_us;
+    };
+    struct RenderReport {
+        std::vector<FrameDrawn> frames;
+        std::vector<RefreshSubmitted> refreshes;
+        uint64_t cells_drawn = 0u;
+        uint64_t cells_unchanged = 0u;
+        uint64_t glyph_hits = 0u;
+        uint64_t draw_us = 0u;
+        uint64_t move_us = 0u;
+        uint64_t refresh_us = 0u;
 
-    int fbfd;
+        void clear() {
+            frames.clear();
+            refreshes.clear();
+            cells_drawn = cells_unchanged = glyph_hits = 0u;
+            draw_us = move_us = refresh_us = 0u;
+        }
+    } report, collected;
+    // the last frame the render thread drew
+    uint64_t drawn_seq = 0u;
+    // Nothing waits for the panel on the main loop: updates to wait for go to panel, see panel_done().
+    // Frames hold off while holding, until the panel completed the update with hold_marker
+    // (e.g., the OSK's, so it doesn't get merged with ours).
+    PanelWaiter panel;
+    bool holding = false;
+    uint32_t hold_marker = 0u;
+    // the screen is cleared once the updates sent before a rotation are complete
+    bool clear_after_hold = false;
+
+    // FBInkBackend unless something else was set before setup()
+    std::unique_ptr<RenderBackend> backend;
     FBInkConfig config = {};
     FBInkState state = {};
 
-    // Used in the commented out term_moverect() implementation:
-    // FBInkDump dump = {};
+    // Direct framebuffer access for the glyph cache and scrolling (nullptr if unsupported)
+    unsigned char * fb = nullptr;
+    size_t fb_size = 0u;
+    GlyphCache glyphs;
 
     bool has_osk = false;
     struct {
@@ -98,26 +179,46 @@ public:
         return state.max_cols;
     }
 
-    void run_timer() {
-        // timer for output debouncing (high throughput mode)
-        if (timer_is_running || timerfd == -1 /* we get called before timerfd creation in setup */) {
-            return;
-        }
-        if (timerfd_settime(timerfd, 0, &ts_on, 0) >= 0) {
-            timer_is_running = true;
-            nticks_without_output = 0;
-        }
-    }
-
     void osk() {
         if (has_osk) {
             unsigned int h = osk_height();
             unsigned int osk_y = state.view_height - h;
             osk_setup(state.view_width, h);
-            osk_render(fbfd, &config, osk_y, state.view_width, h);
+            std::lock_guard<std::mutex> lock(renderer.mutex);
+            osk_render(backend.get(), &config, osk_y, state.view_width, h);
+            hold(backend->last_marker());
         }
     }
 
+    void hold(uint32_t marker) {
+        holding = true;
+        hold_marker = marker;
+        panel.wait_for(marker);
+    }
+
+    // Call this when panel.eventfd is readable
+    void panel_done() {
+        for (const PanelCompletion & done : panel.take()) {
+            trace.complete(done.marker, done.done_us);
+            if (!holding || done.marker != hold_marker) continue;
+            holding = false;
+            if (clear_after_hold) {
+                clear_after_hold = false;
+                {
+                    std::lock_guard<std::mutex> lock(renderer.mutex);
+                    /* NOTE: This is still potentially racy, and *may* fail. (i.e., we *could* retry on non-zero return codes) */
+                    backend->cls(&config);
+                    hold(backend->last_marker());
+                    forget_drawn();
+                }
+                damage.add_all();
+                /* We do need to repaint our OSK */
+                osk();
+            }
+        }
+        render();
+    }
+
     void refresh_input_quirks() {
         // We need to know the canonical rotation to deal with coordinates translation (and we refresh this on reinit)...
         input_quirks.canonical_rota = fbink_rota_native_to_canonical(state.current_rota);
@@ -163,6 +264,296 @@ public:
         }
     }
 
+    // Pages back (pages > 0) or forward through the scrollback, a page is a screen minus one line of context
+    void page(int pages) {
+        int rows = static_cast<int>(nrows());
+        scroll_to(scroll_offset + pages * std::max(rows - 1, 1));
+    }
+
+    void scroll_to(int offset) {
+        offset = std::max(0, std::min(offset, static_cast<int>(scrollback.size())));
+        if (offset == scroll_offset) return;
+        scroll_offset = offset;
+        update_scroll_label();
+        damage.add_all();
+    }
+
+    void update_scroll_label() {
+        int cols = static_cast<int>(ncols());
+        // The old label may be longer
+        damage.add({ 0, 1, cols - static_cast<int>(scroll_label.size()), cols });
+        scroll_label.clear();
+        if (searching) {
+            scroll_label = "/" + search_query + (search_failed ? "_ not found" : "_");
+        }
+        if (scroll_offset > 0) {
+            scroll_label += (scroll_label.empty() ? "[-" : " [-") + std::to_string(scroll_offset) + "/" + std::to_string(scrollback.size()) + "]";
+        }
+        // One cell per character: anything beyond ASCII is a ?
+        std::string ascii;
+        for (char c : scroll_label) {
+            if (!(c & 0x80)) {
+                ascii.push_back(c);
+            } else if ((c & 0xC0) == 0xC0) {
+                ascii.push_back('?');
+            }
+        }
+        scroll_label.swap(ascii);
+        if (scroll_label.size() > static_cast<size_t>(cols)) {
+            scroll_label.erase(0u, scroll_label.size() - static_cast<size_t>(cols));
+        }
+        damage.add({ 0, 1, cols - static_cast<int>(scroll_label.size()), cols });
+    }
+
+    // The cell shown at pos: from the scrollback while paged back, the live screen otherwise
+    void view_cell(const VTermPos & pos, VTermScreenCell * cell) {
+        int cols = static_cast<int>(ncols());
+        size_t line = scrollback.size() - static_cast<size_t>(scroll_offset) + static_cast<size_t>(pos.row);
+        // numbered like in line_text()
+        uint64_t id = scrollback.total() - scrollback.size() + line;
+        if (line >= scrollback.size()) {
+            vterm_screen_get_cell(screen, { pos.row - scroll_offset, pos.col }, cell);
+        } else {
+            if (id != view_line || view_cells.size() != static_cast<size_t>(cols)) {
+                view_cells.resize(static_cast<size_t>(cols));
+                scrollback.get(line, cols, view_cells.data());
+                view_line = id;
+            }
+            *cell = view_cells[static_cast<size_t>(pos.col)];
+        }
+        if (id == match_line && pos.col >= match_col0 && pos.col < match_col1) {
+            std::swap(cell->fg, cell->bg);
+        }
+        int label_col = cols - static_cast<int>(scroll_label.size());
+        if (pos.row == 0 && pos.col >= label_col) {
+            // Drawn like the cursor
+            std::swap(cell->fg, cell->bg);
+            cell->chars[0] = static_cast<unsigned char>(scroll_label[static_cast<size_t>(pos.col - label_col)]);
+            cell->chars[1] = 0u;
+            cell->width = 1;
+        }
+    }
+
+    // Text of the cells, an erased cell is a space. col_of gets the column of every byte.
+    static std::string cells_text(const VTermScreenCell * cells, int cols, std::vector<int> * col_of) {
+        std::string out;
+        for (int col = 0; col < cols; col++) {
+            if (cells[col].chars[0] == static_cast<uint32_t>(-1)) continue;
+            if (cells[col].chars[0] == 0u) {
+                out.push_back(' ');
+            }
+            for (int i = 0; i < VTERM_MAX_CHARS_PER_CELL && cells[col].chars[i]; i++) {
+                put_utf8(out, cells[col].chars[i]);
+            }
+            if (col_of) col_of->resize(out.size(), col);
+        }
+        size_t end = out.find_last_not_of(' ');
+        out.resize(end == std::string::npos ? 0u : end + 1u);
+        return out;
+    }
+
+    // The cells of a line as numbered in line_text()
+    void line_cells(uint64_t line, std::vector<VTermScreenCell> & cells) {
+        int cols = static_cast<int>(ncols());
+        cells.resize(static_cast<size_t>(cols));
+        uint64_t first = scrollback.total() - scrollback.size();
+        if (line < scrollback.total()) {
+            scrollback.get(static_cast<size_t>(line - first), cols, cells.data());
+            return;
+        }
+        VTermPos pos = { static_cast<int>(line - scrollback.total()), 0 };
+        for (pos.col = 0; pos.col < cols; pos.col++) {
+            vterm_screen_get_cell(screen, pos, &cells[static_cast<size_t>(pos.col)]);
+        }
+    }
+
+    // Lines are numbered from the first one that ever went to the scrollback, the rows
+    // of the live screen come right after the newest scrollback line
+    std::string line_text(uint64_t line) {
+        if (line < scrollback.total()) {
+            return scrollback.text(static_cast<size_t>(line - (scrollback.total() - scrollback.size())));
+        }
+        std::vector<VTermScreenCell> cells;
+        line_cells(line, cells);
+        return cells_text(cells.data(), static_cast<int>(cells.size()), nullptr);
+    }
+
+    // The newest line before (older) or the oldest line after from that contains needle
+    // (folded with search_fold()), or UINT64_MAX. The scrollback goes through the index,
+    // the few rows of the live screen are read as they are.
+    uint64_t find_line(const std::string & needle, uint64_t from, bool older) {
+        uint64_t first = scrollback.total() - scrollback.size();
+        uint64_t live = scrollback.total();
+        uint64_t end = live + nrows();
+        auto text_of = [this](uint64_t line) { return search_fold(line_text(line)); };
+        if (older) {
+            for (uint64_t line = std::min(from, end); line-- > live;) {
+                if (text_of(line).find(needle) != std::string::npos) return line;
+            }
+            return search.find_older(needle, first, std::min(from, live), text_of);
+        }
+        uint64_t found = search.find_newer(needle, from + 1u, live, text_of);
+        if (found != UINT64_MAX) return found;
+        for (uint64_t line = std::max(from + 1u, live); line < end; line++) {
+            if (text_of(line).find(needle) != std::string::npos) return line;
+        }
+        return UINT64_MAX;
+    }
+
+    // Highlights needle in line, and pages there unless it is in view already
+    void show_match(uint64_t line, const std::string & needle) {
+        std::vector<VTermScreenCell> cells;
+        line_cells(line, cells);
+        std::vector<int> col_of;
+        std::string text = search_fold(cells_text(cells.data(), static_cast<int>(cells.size()), &col_of));
+        size_t at = text.find(needle);
+        if (at == std::string::npos) return;
+        match_line = line;
+        match_col0 = col_of[at];
+        int last = col_of[at + needle.size() - 1u];
+        match_col1 = last + std::max<int>(cells[static_cast<size_t>(last)].width, 1);
+        int rows = static_cast<int>(nrows());
+        uint64_t top = scrollback.total() - static_cast<uint64_t>(scroll_offset);
+        if (line < top || line >= top + static_cast<uint64_t>(rows)) {
+            // A third down the screen, with some of what led up to it above
+            scroll_offset = static_cast<int>(scrollback.total() - line) + rows / 3;
+            scroll_offset = std::max(0, std::min(scroll_offset, static_cast<int>(scrollback.size())));
+        }
+        update_scroll_label();
+        damage.add_all();
+    }
+
+    // Shows the next match of search_query, going back (older) or forward
+    bool search_step(bool older) {
+        std::string needle = search_fold(search_query);
+        if (needle.empty()) return false;
+        uint64_t from = match_line;
+        if (from == UINT64_MAX) {
+            if (!older) return false;
+            from = scrollback.total() + nrows();
+        }
+        uint64_t line = find_line(needle, from, older);
+        search_failed = line == UINT64_MAX;
+        if (search_failed) {
+            update_scroll_label();
+            return false;
+        }
+        show_match(line, needle);
+        return true;
+    }
+
+    // Keys typed from here on edit the query, each change searches back from the bottom.
+    // Enter and Up go to the next older match, Down to the next newer, Escape ends the search.
+    void start_search() {
+        searching = true;
+        search_query.clear();
+        search_failed = false;
+        update_scroll_label();
+    }
+
+    // Drops the highlight, the view stays where it is
+    void end_search() {
+        if (match_line != UINT64_MAX) {
+            damage.add_all();
+        }
+        searching = false;
+        search_failed = false;
+        search_query.clear();
+        match_line = UINT64_MAX;
+        update_scroll_label();
+    }
+
+    // Takes the keys meant for the search (see start_search()), the rest is left for the shell
+    void search_keys(std::deque<char> & keys) {
+        while (searching && !keys.empty()) {
+            char c = keys.front();
+            keys.pop_front();
+            if (c == '\033') {
+                if (keys.size() >= 2u && keys[0] == '[' && (keys[1] == 'A' || keys[1] == 'B')) {
+                    search_step(keys[1] == 'A');
+                    keys.erase(keys.begin(), keys.begin() + 2);
+                } else {
+                    searching = false;
+                    search_failed = false;
+                    update_scroll_label();
+                }
+                continue;
+            }
+            if (c == '\r' || c == '\n') {
+                search_step(true);
+                continue;
+            }
+            if (c == 0x7f || c == 0x08) {
+                // A whole UTF-8 sequence
+                while (!search_query.empty() && (search_query.back() & 0xC0) == 0x80) {
+                    search_query.pop_back();
+                }
+                if (!search_query.empty()) {
+                    search_query.pop_back();
+                }
+            } else if (static_cast<unsigned char>(c) >= 0x20u) {
+                search_query.push_back(c);
+            } else {
+                continue;
+            }
+            if (match_line != UINT64_MAX) {
+                match_line = UINT64_MAX;
+                damage.add_all();
+            }
+            if (!search_step(true)) {
+                update_scroll_label();
+            }
+        }
+    }
+
+    // For the http keyboard: up to max matches of query, newest first, as "<line>\t<text>\n" lines.
+    // Shows the match on line if it is one, the newest match otherwise. An empty query goes back to the live screen.
+    std::string search_list(const std::string & query, uint64_t line, size_t max) {
+        end_search();
+        std::string needle = search_fold(query);
+        if (needle.empty()) {
+            scroll_to(0);
+            return "";
+        }
+        search_query = query;
+        std::string out;
+        uint64_t show = UINT64_MAX;
+        uint64_t found = scrollback.total() + nrows();
+        for (size_t n = 0u; n < max; n++) {
+            found = find_line(needle, found, true);
+            if (found == UINT64_MAX) break;
+            if (show == UINT64_MAX || found == line) show = found;
+            out += std::to_string(found) + "\t" + line_text(found) + "\n";
+        }
+        bool valid = line >= scrollback.total() - scrollback.size() && line < scrollback.total() + nrows();
+        if (valid && show != line && search_fold(line_text(line)).find(needle) != std::string::npos) {
+            show = line;
+        }
+        if (show != UINT64_MAX) {
+            show_match(show, needle);
+        }
+        return out;
+    }
+
+    // The render path's metrics, see RenderMetrics
+    void metrics_text(std::string & out) {
+        collect();
+        metrics.print(out);
+        trace.print(out);
+        RenderStats stats;
+        {
+            std::lock_guard<std::mutex> lock(renderer.mutex);
+            stats = backend->stats;
+        }
+        metric(out, "inkvt_frames_total", "counter", "Frames drawn", stats.frames);
+        metric(out, "inkvt_pixels_written_total", "counter", "Pixels written to the framebuffer", stats.pixels_written);
+        metric(out, "inkvt_refreshes_total", "counter", "Refreshes submitted", stats.refreshes);
+        metric(out, "inkvt_refresh_pixels_total", "counter", "Area of the submitted refreshes, in pixels", stats.refresh_area);
+        metric(out, "inkvt_scrollback_lines", "gauge", "Lines in the scrollback", scrollback.size());
+        metric(out, "inkvt_scrollback_bytes", "gauge", "Memory used by the scrollback and its search index",
+                scrollback.bytes() + search.bytes());
+    }
+
     const char * click(int32_t x, int32_t y) {
         // (do not) draw ugly cursor
         if (0) {
@@ -170,8 +561,7 @@ public:
             short cfg_col = config.col;
             config.row = 0;
             config.col = 0;
-            fbink_print_raw_data(
-                    fbfd,
+            backend->print_raw_data(
                     cursor.dst,
                     cursor.width,
                     cursor.height,
@@ -202,6 +592,11 @@ public:
         // the returned string is only correct up to the next call to this function
         unsigned int h = osk_height();
         unsigned int osk_y = state.view_height - h;
+        if (y >= 0 && static_cast<unsigned int>(y) < osk_y) {
+            // Taps on the terminal page through the scrollback: back in the top half, forward in the bottom half
+            page(static_cast<unsigned int>(y) < osk_y / 2u ? 1 : -1);
+            return "";
+        }
         const kbkey * b = osk_press(state.view_width, osk_height(), static_cast<unsigned int>(x), static_cast<unsigned int>(y - osk_y));
         if (!b) {
             printf("Touch event; but no key @ (%d, %d)\n", x, y);
@@ -221,6 +616,11 @@ public:
                 OSK.ALT = 1;
                 return "";
         }
+        if (OSK.FN && strcmp(b->fn, "Find") == 0) {
+            OSK.SHIFT = OSK.CTRL = OSK.ALT = OSK.FN = 0;
+            start_search();
+            return "";
+        }
         const char * out = b->normal;
         if (OSK.FN && strlen(b->fn) > 0) {
             out = b->fn;
@@ -257,178 +657,398 @@ public:
         return out;
     }
 
-    void tick() {
-        if (high_throughput_mode && nwrites_in_interval < high_throughput_threshold) {
-            high_throughput_mode = false;
-            VTermRect full_refresh = { 0, 0, 0, 0 };
-            full_refresh.end_col = ncols();
-            full_refresh.end_row = nrows();
-            term_damage(full_refresh, this);
-        }
-        if (nwrites_in_interval == 0) {
-            nticks_without_output += 1;
-            if (nticks_without_output > TIMER_SLEEP_MODE_THRESHOLD) {
-                timerfd_settime(timerfd, 0, &ts_off, 0);
-                timer_is_running = false;
-            }
-        } else {
-            nticks_without_output = 0;
-        }
-        nwrites_in_interval = 0;
-    }
-
     bool reinit() {
         // only call this from main (yeah bad code...)
         // because we need to resize the pty too
-        int res = fbink_reinit(fbfd, &config);
+        // Nothing changes under the render thread: when it's busy, the next call checks again
+        if (!renderer.can_publish()) return false;
+        std::unique_lock<std::mutex> lock(renderer.mutex, std::try_to_lock);
+        if (!lock.owns_lock()) return false;
+        int res = backend->reinit(&config, &state);
         if (res > EXIT_SUCCESS) {
+            /* The state now tracks the new rotation/layout/bitdepth */
+            /* The framebuffer may have been remapped, and the cached glyphs are stale anyway */
+            setup_fb_access();
             if (res & OK_ROTA_CHANGE) {
-                /* Update the state to track the new rotation */
-                fbink_get_state(&config, &state);
                 printf("fbink_reinit w/ ROTA_CHANGE\n");
                 /* Recompute input translation */
                 refresh_input_quirks();
-                /* Update the high throughput threshold */
-                high_throughput_threshold = state.max_cols * state.max_rows;
-                /* Clear screen and wait to make sure we get rid of potential broken updates
-                 * that might have been sent against the wrong state (i.e., race during the rotation).
+                /* Once the panel is done with the updates that might have been sent against the wrong state
+                 * (i.e., race during the rotation), clear the screen to get rid of them, see panel_done().
                  */
-                fbink_wait_for_complete(fbfd, LAST_MARKER);
-                /* NOTE: This is still potentially racy, and *may* fail. (i.e., we *could* retry on non-zero return codes) */
-                fbink_cls(fbfd, &config, nullptr, false);
-                fbink_wait_for_complete(fbfd, LAST_MARKER);
+                clear_after_hold = true;
+                hold(backend->last_marker());
             }
             if (res & OK_LAYOUT_CHANGE) {
                 /* We only actually care about layout changes */
                 printf("fbink_reinit w/ LAYOUT_CHANGE\n");
-                vterm_screen_reset(screen, 1);
+                /* libvterm pushes rows that no longer fit to the scrollback, and pops them back when there's room again */
                 vterm_set_size(term, nrows(), ncols());
+                damage.resize(nrows(), ncols());
+                scroll_to(0);
             }
-            if (res & OK_ROTA_CHANGE) {
-                /* But we do need to repaint our OSK */
-                osk();
-            }
+            /* Whatever happened, the next frame repaints everything */
+            moves.clear();
+            forget_drawn();
+            damage.add_all();
             return true;
         }
         return false;
     }
 
-    void update_fg_color(VTermColor * c) {
+    static uint32_t pack_rgb(uint8_t r, uint8_t g, uint8_t b) {
+        return static_cast<uint32_t>(r) << 16 | static_cast<uint32_t>(g) << 8 | b;
+    }
+
+    uint32_t fg_color(VTermColor * c) {
         vterm_screen_convert_color_to_rgb(screen, c);
 #define FG(x) static_cast<uint8_t>((x^0xFFu) / 2u)
 #define BG(x) static_cast<uint8_t>(x^0xFFu)
-        fbink_set_fg_pen_rgba(FG(c->rgb.red), FG(c->rgb.green), FG(c->rgb.blue), 0xFFu, false, true);
+        return pack_rgb(FG(c->rgb.red), FG(c->rgb.green), FG(c->rgb.blue));
     }
 
-    void update_bg_color(VTermColor * c) {
+    uint32_t bg_color(VTermColor * c) {
         vterm_screen_convert_color_to_rgb(screen, c);
-        fbink_set_bg_pen_rgba(BG(c->rgb.red), BG(c->rgb.green), BG(c->rgb.blue), 0xFFu, false, true);
+        return pack_rgb(BG(c->rgb.red), BG(c->rgb.green), BG(c->rgb.blue));
 #undef BG
 #undef FG
     }
 
-    void output_char(const VTermPos & pos) {
-        // high throughput stuff
-        nwrites_in_interval += 1;
-        if (timer_is_running) {
-            if (high_throughput_mode) return;
-            if (nwrites_in_interval >= high_throughput_threshold) {
-                high_throughput_mode = true;
-                // fprintf(stdout, "Enabling high_throughput_mode (%ld >= %ld)\n", nwrites_in_interval, high_throughput_threshold);
-            }
-        } else {
-            run_timer();
+    void setup_fb_access() {
+        // FBInk rotates coordinates in software on quirky landscape devices,
+        // and packs several pixels per byte below 8bpp: leave those to fbink_print
+        fb = nullptr;
+        fb_size = 0u;
+        glyphs.clear();
+        if (state.bpp < 8u || state.is_ntx_quirky_landscape) {
+            return;
+        }
+        fb = backend->framebuffer(&fb_size);
+        glyphs.reset(state.glyph_width, state.glyph_height, state.bpp / 8u);
+    }
+
+    // Top left pixel of a cell in the framebuffer, nullptr if we can't draw it directly
+    uint8_t * cell_pixels(const VTermPos & pos) {
+        if (!fb) return nullptr;
+        size_t x = state.view_hori_origin + static_cast<size_t>(pos.col) * state.glyph_width;
+        size_t y = state.view_vert_origin + static_cast<size_t>(pos.row) * state.glyph_height;
+        size_t offset = y * state.scanline_stride + x * glyphs.bytes_per_pixel;
+        size_t end = offset + (glyphs.height - 1u) * state.scanline_stride + glyphs.row_bytes();
+        if (end > fb_size) return nullptr;
+        return fb + offset;
+    }
+
+    void forget_drawn() {
+        GlyphKey unknown = {};
+        unknown.codepoint = GLYPH_UNKNOWN;
+        drawn_cols = static_cast<int>(ncols());
+        drawn.assign(static_cast<size_t>(nrows()) * ncols(), unknown);
+    }
+
+    GlyphKey & drawn_at(const VTermPos & pos) {
+        return drawn[static_cast<size_t>(pos.row) * static_cast<size_t>(drawn_cols) + static_cast<size_t>(pos.col)];
+    }
+
+    // The pixels of src were moved to dst: so is our idea of what they show
+    void move_drawn(const VTermRect & dst, const VTermRect & src) {
+        size_t n = static_cast<size_t>(dst.end_col - dst.start_col) * sizeof(GlyphKey);
+        int nmoved = dst.end_row - dst.start_row;
+        bool upwards = dst.start_row <= src.start_row;
+        for (int i = 0; i < nmoved; i++) {
+            int k = upwards ? i : nmoved - 1 - i;
+            memmove(&drawn_at({ dst.start_row + k, dst.start_col }), &drawn_at({ src.start_row + k, src.start_col }), n);
         }
-        // drawing stuff
+    }
+
+    // Reads what pos shows into frame, on the main thread: the render thread never touches libvterm
+    void snapshot_cell(const VTermPos & pos, Frame & frame) {
         VTermScreenCell cell;
-        vterm_screen_get_cell(screen, pos, &cell);
+        view_cell(pos, &cell);
+        bool is_cursor = scroll_offset == 0 && pos.row == last_cursor.row && pos.col == last_cursor.col;
+        // The right half of a wide character is cleared like an empty cell, its codepoint (-1) would pass for GLYPH_UNKNOWN
+        bool widegap = cell.chars[0] == static_cast<uint32_t>(-1);
+        FrameCell c;
+        c.key.codepoint = widegap ? 0u : cell.chars[0];
+        c.key.fg = fg_color(is_cursor ? &cell.bg : &cell.fg);
+        c.key.bg = bg_color(is_cursor ? &cell.fg : &cell.bg);
+        c.key.attrs = static_cast<uint8_t>((cell.attrs.bold ? GLYPH_BOLD : 0u) | (cell.attrs.italic ? GLYPH_ITALIC : 0u));
+        c.cacheable = cell.width == 1 && (cell.chars[0] == 0 || cell.chars[1] == 0);
+        c.text_offset = static_cast<uint32_t>(frame.text.size());
+        if (!widegap) {
+            for (int i = 0; i < VTERM_MAX_CHARS_PER_CELL && cell.chars[i]; i++) {
+                put_utf8(frame.text, cell.chars[i]);
+            }
+        }
+        c.text_len = static_cast<uint32_t>(frame.text.size()) - c.text_offset;
+        // NUL terminated, for print()
+        frame.text.push_back('\0');
+        frame.cells.push_back(c);
+    }
+
+    // Draws a cell without refreshing it, callers refresh the whole damaged area at once.
+    // Returns false if the cell already showed exactly this. Render thread only.
+    bool output_char(const VTermPos & pos, const FrameCell & c, const Frame & frame) {
         config.col = static_cast<short int>(pos.col);
         config.row = static_cast<short int>(pos.row);
-        if (pos.row == last_cursor.row && pos.col == last_cursor.col) {
-            update_fg_color(&cell.bg);
-            update_bg_color(&cell.fg);
-        } else {
-            update_fg_color(&cell.fg);
-            update_bg_color(&cell.bg);
-        }
-        VTermRect rect;
-        rect.start_row = pos.row;
-        rect.start_col = pos.col;
-        rect.end_col = pos.col + 1;
-        rect.end_row = pos.row + 1;
-        char buf[32];
-        size_t nread = vterm_screen_get_text(screen, buf, sizeof(buf)-1, rect);
-        buf[nread] = 0;
-        if (nread == 0) {
-            fbink_grid_clear(fbfd, 1U, 1U, &config);
+        GlyphKey & shown = drawn_at(pos);
+        if (c.cacheable && shown == c.key) {
+            report.cells_unchanged += 1u;
+            return false;
+        }
+        report.cells_drawn += 1u;
+        shown = c.key;
+        if (!c.cacheable) {
+            shown.codepoint = GLYPH_UNKNOWN;
+        }
+        uint8_t * dst = c.cacheable ? cell_pixels(pos) : nullptr;
+        backend->stats.pixels_written += static_cast<uint64_t>(state.glyph_width) * state.glyph_height;
+        if (dst && glyphs.blit(c.key, dst, state.scanline_stride)) {
+            report.glyph_hits += 1u;
+            return true;
+        }
+        if (c.text_len == 0u) {
+            backend->grid_clear(1U, 1U, c.key.bg, &config);
         } else {
-            fbink_print(fbfd, buf, &config);
+            backend->print(frame.text.c_str() + c.text_offset, c.key.fg, c.key.bg, &config);
         }
+        if (dst) {
+            glyphs.capture(c.key, dst, state.scanline_stride);
+        }
+        return true;
     }
 
-    void write(char byte) {
-        vterm_input_write(term, &byte, 1);
+    // Render thread: moves the pixels of the frame's scrolls, draws its cells and queues their refreshes
+    void draw_frame(const Frame & frame) {
+        long start = monotonic_us();
+        for (const FrameMove & move : frame.moves) {
+            if (move_pixels(move.dst, move.src)) {
+                move_drawn(move.dst, move.src);
+                refresher.add(move.dst);
+            }
+        }
+        long draw_start = monotonic_us();
+        report.move_us += static_cast<uint64_t>(draw_start - start);
+        config.no_refresh = true;
+        for (const FrameRow & r : frame.rows) {
+            // Only refresh the columns that actually changed
+            int col0 = r.col1;
+            int col1 = r.col0;
+            for (int col = r.col0; col < r.col1; col++) {
+                if (output_char({ r.row, col }, frame.cells[r.first_cell + static_cast<size_t>(col - r.col0)], frame)) {
+                    col0 = std::min(col0, col);
+                    col1 = col + 1;
+                }
+            }
+            refresher.add({ r.row, r.row + 1, col0, col1 });
+        }
+        config.no_refresh = false;
+        backend->stats.frames += 1u;
+        drawn_seq = frame.seq;
+        long now = monotonic_us();
+        report.draw_us += static_cast<uint64_t>(now - draw_start);
+        report.frames.push_back({ frame.seq, now });
     }
 
-    static int term_damage(VTermRect rect, void * user) {
-        VTermToFBInk * me = static_cast<VTermToFBInk*>(user);
-        VTermPos pos;
-        int row, col;
+    // Render thread: submits the refreshes that are due, returns the ms until the next one or -1
+    long run_refresher() {
+        VTermRect full = { 0, static_cast<int>(nrows()), 0, static_cast<int>(ncols()) };
+        uint64_t refreshes = backend->stats.refreshes;
+        long start = monotonic_us();
+        long ms = refresher.run(backend.get(), &config, state, full);
+        long now = monotonic_us();
+        report.refresh_us += static_cast<uint64_t>(now - start);
+        if (backend->stats.refreshes != refreshes) {
+            report.refreshes.push_back({ drawn_seq, backend->last_marker(), now });
+        }
+        return ms;
+    }
 
-        // fprintf(stdout, "Called term_damage on (%d, %d) to (%d, %d)\n", rect.start_col, rect.start_row, rect.end_col, rect.end_row);
-        // NOTE: Optimize large rects by only doing a single refresh call, instead of paired with cell-per-cell drawing.
-        me->config.no_refresh = true;
-
-        for (row = rect.start_row; row < rect.end_row; row++) {
-            for (col = rect.start_col; col < rect.end_col; col++) {
-                pos.col = col;
-                pos.row = row;
-                // NOTE: And again after the print call
-                // if (cell.attrs.reverse) me->config->is_inverted = !me->config->is_inverted;
-                me->output_char(pos);
+    // Takes over what the render thread reported, unless it is busy (then it signals renderer.done_fd when it's done)
+    void collect() {
+        {
+            std::unique_lock<std::mutex> lock(renderer.mutex, std::try_to_lock);
+            if (!lock.owns_lock()) return;
+            std::swap(collected, report);
+        }
+        metrics.cells_drawn += collected.cells_drawn;
+        metrics.cells_unchanged += collected.cells_unchanged;
+        metrics.glyph_hits += collected.glyph_hits;
+        metrics.draw_us += collected.draw_us;
+        metrics.move_us += collected.move_us;
+        metrics.refresh_us += collected.refresh_us;
+        for (const FrameDrawn & f : collected.frames) {
+            trace.drawn(f.seq, f.done_us);
+        }
+        for (const RefreshSubmitted & r : collected.refreshes) {
+            if (metrics.input_frame != 0u && r.seq >= metrics.input_frame) {
+                metrics.input_to_refresh.add(r.t_us - metrics.input_us);
+                metrics.input_us = -1;
+                metrics.input_answered = false;
+                metrics.input_frame = 0u;
+            }
+            if (trace.submitted(r.seq, r.marker, r.t_us)) {
+                panel.wait_for(r.marker);
+            }
+        }
+        collected.clear();
+    }
+
+    void write(const char * bytes, size_t len) {
+        long start = monotonic_us();
+        vterm_input_write(term, bytes, len);
+        metrics.write_us += static_cast<uint64_t>(monotonic_us() - start);
+        metrics.bytes_parsed += len;
+        if (metrics.input_us != -1) metrics.input_answered = true;
+        unflushed = true;
+    }
+
+    // Everything written so far is on the screen, and refreshed
+    bool idle() {
+        bool cursor_moved = last_cursor.row != drawn_cursor.row || last_cursor.col != drawn_cursor.col;
+        if (unflushed || !damage.empty() || cursor_moved || !moves.empty() || holding || !renderer.can_publish()) {
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(renderer.mutex, std::try_to_lock);
+        return lock.owns_lock() && report.frames.empty() && report.refreshes.empty() && refresher.idle();
+    }
+
+    // Hand everything that was damaged since the last frame to the render thread, which draws it and refreshes it.
+    // Frames are paced: an idle screen is drawn right away, a busy one at most every refresher.latency_ms,
+    // with all the damage in between coalesced. libvterm holds on to its damage until then,
+    // so consecutive scrolls reach us as a single moverect. While the render thread is still busy with
+    // the last frame, damage keeps piling up until it's done.
+    // Call this after every batch of input, when frame_timerfd fires and when renderer.done_fd is readable.
+    void render() {
+        collect();
+        if (holding || !renderer.can_publish()) return;
+        bool cursor_moved = last_cursor.row != drawn_cursor.row || last_cursor.col != drawn_cursor.col;
+        if (!unflushed && damage.empty() && !cursor_moved && moves.empty()) return;
+        long since_frame = monotonic_ms() - last_frame_ms;
+        if (since_frame < refresher.latency_ms) {
+            arm_frame_timer(refresher.latency_ms - since_frame);
+            return;
+        }
+        long frame_start = monotonic_us();
+        vterm_screen_flush_damage(screen);
+        unflushed = false;
+        // The cursor cell is drawn inverted: both where it was and where it is now need a repaint
+        if (cursor_moved) {
+            damage.add(drawn_cursor);
+            damage.add(last_cursor);
+            drawn_cursor = last_cursor;
+        }
+        Frame & frame = renderer.frame;
+        frame.clear();
+        frame.seq = ++frame_seq;
+        frame.moves.swap(moves);
+        damage.for_each([this, &frame](int row, int start_col, int end_col) {
+            frame.rows.push_back({ row, start_col, end_col, frame.cells.size() });
+            for (int col = start_col; col < end_col; col++) {
+                snapshot_cell({ row, col }, frame);
             }
+        });
+        damage.clear();
+        last_frame_ms = monotonic_ms();
+        metrics.frame_time.add(monotonic_us() - frame_start);
+        trace.published(frame.seq);
+        if (metrics.input_answered && metrics.input_frame == 0u) {
+            metrics.input_frame = frame.seq;
+        }
+        renderer.publish();
+    }
+
+    void arm_frame_timer(long ms) {
+        itimerspec ts = {};
+        if (ms >= 0) {
+            ms = std::max(ms, 1L);
+            ts.it_value.tv_sec = ms / 1000L;
+            ts.it_value.tv_nsec = (ms % 1000L) * 1000000L;
         }
+        timerfd_settime(frame_timerfd, 0, &ts, 0);
+    }
+
+    static bool rect_contains(const VTermRect & rect, const VTermPos & pos) {
+        return pos.row >= rect.start_row && pos.row < rect.end_row
+            && pos.col >= rect.start_col && pos.col < rect.end_col;
+    }
+
+    // Both rects can be reached directly, and stay inside our grid (e.g., out of the OSK)
+    bool can_move(const VTermRect & dst, const VTermRect & src) {
+        int rows = static_cast<int>(nrows());
+        if (dst.end_row > rows || src.end_row > rows) return false;
+        return cell_pixels({ dst.start_row, dst.start_col }) && cell_pixels({ src.start_row, src.start_col })
+            && cell_pixels({ dst.end_row - 1, dst.end_col - 1 }) && cell_pixels({ src.end_row - 1, src.end_col - 1 });
+    }
 
-        // Refresh the full rectangle
-        me->config.no_refresh = false;
-        me->config.col = static_cast<short int>(rect.start_col);
-        me->config.row = static_cast<short int>(rect.start_row);
-        fbink_grid_refresh(me->fbfd, static_cast<unsigned short int>(rect.end_col - rect.start_col), static_cast<unsigned short int>(rect.end_row - rect.start_row), &me->config);
+    // memmove() the pixels of src to dst, row by row, in an order that is safe for overlapping rects.
+    // Returns false if that's not possible, see can_move().
+    bool move_pixels(const VTermRect & dst, const VTermRect & src) {
+        if (!can_move(dst, src)) return false;
+        uint8_t * d = cell_pixels({ dst.start_row, dst.start_col });
+        uint8_t * s = cell_pixels({ src.start_row, src.start_col });
+        size_t stride = state.scanline_stride;
+        size_t nbytes = static_cast<size_t>(dst.end_col - dst.start_col) * glyphs.row_bytes();
+        size_t nlines = static_cast<size_t>(dst.end_row - dst.start_row) * glyphs.height;
+        backend->stats.pixels_written += nbytes / glyphs.bytes_per_pixel * nlines;
+        if (d < s) {
+            for (size_t y = 0u; y < nlines; y++) {
+                memmove(d + y * stride, s + y * stride, nbytes);
+            }
+        } else {
+            for (size_t y = nlines; y-- > 0u;) {
+                memmove(d + y * stride, s + y * stride, nbytes);
+            }
+        }
+        return true;
+    }
 
+    static int term_damage(VTermRect rect, void * user) {
+        // fprintf(stdout, "Called term_damage on (%d, %d) to (%d, %d)\n", rect.start_col, rect.start_row, rect.end_col, rect.end_row);
+        VTermToFBInk * me = static_cast<VTermToFBInk*>(user);
+        // While paged back, the live screen is shown scroll_offset rows further down
+        rect.start_row += me->scroll_offset;
+        rect.end_row += me->scroll_offset;
+        me->damage.add(rect);
         return 1;
     }
 
-    static int term_movecursor(VTermPos pos, VTermPos old, int visible __attribute__((unused)), void * user) {
+    static int term_movecursor(VTermPos pos, VTermPos old __attribute__((unused)), int visible __attribute__((unused)), void * user) {
         // fprintf(stdout, "Called term_movecursor from (%d, %d) to (%d, %d)\n", old.col, old.row, pos.col, pos.row);
         VTermToFBInk * me = static_cast<VTermToFBInk*>(user);
-        me->last_cursor = pos; // keep track of cursor in high_throughput_mode
-        if (me->high_throughput_mode) return 1;
-        me->output_char(old); // remove previous cursor
-        me->output_char(pos); // add new cursor
+        // render() repaints both the old and the new cursor cell
+        me->last_cursor = pos;
         return 1;
     }
 
-    static int term_moverect(VTermRect dst, VTermRect src __attribute__((unused)), void * user) {
+    static int term_moverect(VTermRect dst, VTermRect src, void * user) {
         // fprintf(stdout, "Called term_moverect from (%d, %d), (%d, %d) to (%d, %d), (%d, %d)\n", src.start_col, src.start_row, src.end_col, src.end_row, dst.start_col, dst.start_row, dst.end_col, dst.end_row);
-        term_damage(dst, user);
-        return 1;
-        /*
-        // 'more effcient memcpy implementation':
-        // This works sort of but is very buggy. Especially in the linux
-        // console, which likes to overwrite some parts of the screen sometimes...
-        VTermToFBInk * me = (VTermToFBInk*)user;
-        unsigned short int w, h;
-        w = me->state.glyph_width*(src.end_col - src.start_col);
-        h = me->state.glyph_height*(src.end_row - src.start_row);
-        me->config.col = src.start_col;
-        me->config.row = src.start_row;
-        fbink_region_dump(me->fbfd, 0, 0, w, h, &me->config, &me->dump);
-        me->config.col = dst.start_col;
-        me->config.row = dst.start_row;
-        fbink_print_raw_data(me->fbfd, me->dump.data,
-                w, h, me->dump.size, 0, 0, &me->config);
+        VTermToFBInk * me = static_cast<VTermToFBInk*>(user);
+        if (me->scroll_offset > 0) {
+            // The view stays put while paged back (see term_sb_pushline), only redraw what it shows of dst
+            term_damage(dst, user);
+            return 1;
+        }
+        // When most of the destination has to be redrawn anyway (e.g., a burst of scrolling within a single frame),
+        // moving pixels around is wasted memory bandwidth
+        bool mostly_dirty = 2 * me->damage.count(dst.start_row, dst.end_row) > dst.end_row - dst.start_row;
+        if (mostly_dirty || !me->can_move(dst, src)) {
+            me->damage.add(dst);
+            return 1;
+        }
+        // The render thread moves the pixels before it draws the next frame.
+        // Whatever was still waiting to be drawn in src moved along,
+        // libvterm damages the newly exposed lines itself.
+        me->moves.push_back({ dst, src });
+        me->damage.move(dst, src);
+        // The cursor cell is drawn inverted: wherever its pixels were moved to, and whatever was moved onto it needs a repaint.
+        VTermPos moved = { me->drawn_cursor.row + dst.start_row - src.start_row, me->drawn_cursor.col + dst.start_col - src.start_col };
+        if (rect_contains(src, me->drawn_cursor) && rect_contains(dst, moved)) {
+            me->damage.add(moved);
+        }
+        if (rect_contains(dst, me->drawn_cursor)) {
+            me->damage.add(me->drawn_cursor);
+        }
         return 1;
-        */
     }
 
     static int term_settermprop(VTermProp prop __attribute__((unused)), VTermValue * val __attribute__((unused)), void * user __attribute__((unused))) {
@@ -439,6 +1059,45 @@ public:
         return 0;
     }
 
+    static int term_sb_pushline(int cols, const VTermScreenCell * cells, void * user) {
+        VTermToFBInk * me = static_cast<VTermToFBInk*>(user);
+        uint64_t line = me->scrollback.total();
+        me->scrollback.push(cols, cells);
+        if (me->scrollback.total() > line) {
+            me->search.push(line, search_fold(me->scrollback.text(me->scrollback.size() - 1u)));
+            me->search.drop_before(me->scrollback.total() - me->scrollback.size());
+        }
+        if (me->scroll_offset > 0) {
+            // Keep showing the same lines
+            me->scroll_offset = std::min(me->scroll_offset + 1, static_cast<int>(me->scrollback.size()));
+            me->update_scroll_label();
+        }
+        return 1;
+    }
+
+    static int term_sb_popline(int cols, VTermScreenCell * cells, void * user) {
+        VTermToFBInk * me = static_cast<VTermToFBInk*>(user);
+        // The next push may reuse the popped line's number
+        me->view_line = UINT64_MAX;
+        if (!me->scrollback.pop(cols, cells)) return 0;
+        me->search.pop();
+        if (me->scroll_offset > 0) {
+            me->scroll_offset = std::min(me->scroll_offset, static_cast<int>(me->scrollback.size()));
+            me->update_scroll_label();
+        }
+        return 1;
+    }
+
+    static int term_sb_clear(void * user) {
+        VTermToFBInk * me = static_cast<VTermToFBInk*>(user);
+        me->scrollback.clear();
+        me->search.clear();
+        me->view_line = UINT64_MAX;
+        me->end_search();
+        me->scroll_to(0);
+        return 1;
+    }
+
     static FONT_INDEX_E get_font(const char * font_cstr) {
         std::string font(font_cstr);
         if (font == "ibm") return FONT_INDEX_E::IBM;
@@ -486,23 +1145,21 @@ public:
         cursor.spacing = 0.f;
         cursor.radius = 5.f;
         cursor.render();
-        fbfd = fbink_open();
-        if (fbfd == -1) {
-            puts("fbink_open()");
-            exit(1);
-        }
         config.fontname = get_font(fontname);
         config.fontmult = fontmult;
-        fbink_init(fbfd, &config);
-        fbink_cls(fbfd, &config, nullptr, false);
-        fbink_get_state(&config, &state);
+        if (!backend) {
+            backend.reset(new FBInkBackend());
+        }
+        if (!backend->open(&config, &state)) {
+            exit(1);
+        }
+        panel.start(backend.get());
         /* Compute input translation */
         refresh_input_quirks();
+        setup_fb_access();
         config.is_quiet = true;
         config.is_verbose = false;
         fbink_update_verbosity(&config);
-        /* Set the high throughput threshold at a screenful */
-        high_throughput_threshold = state.max_cols * state.max_rows;
 
         // None of the dithering mechanisms deal very well with tiny refresh regions, so,
         // this doesn't really work all that well... :/
@@ -522,25 +1179,29 @@ public:
             .settermprop = VTermToFBInk::term_settermprop,
             .bell = VTermToFBInk::term_bell,
             .resize = 0,
-            .sb_pushline = 0,
-            .sb_popline = 0,
-            .sb_clear = 0
+            .sb_pushline = VTermToFBInk::term_sb_pushline,
+            .sb_popline = VTermToFBInk::term_sb_popline,
+            .sb_clear = VTermToFBInk::term_sb_clear
         };
+        damage.resize(nrows(), ncols());
+        forget_drawn();
         term = vterm_new(nrows(), ncols());
         vterm_set_utf8(term, 1);
         screen = vterm_obtain_screen(term);
         vterm_screen_set_callbacks(screen, &vtsc, this);
+        // Merge scrolls and damage until render() flushes them
+        vterm_screen_set_damage_merge(screen, VTERM_DAMAGE_SCROLL);
         vterm_screen_enable_altscreen(screen, 1);
         vterm_screen_reset(screen, 1);
 
-        timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
-        if (timerfd == -1) {
+        frame_timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+        if (frame_timerfd == -1) {
             perror("timerfd_create");
             exit(1);
         }
-        ts_on.it_value.tv_nsec = INTERVAL_MS*1000000;
-        ts_on.it_interval.tv_nsec = INTERVAL_MS*1000000;
-        timerfd_settime(timerfd, 0, &ts_off, 0);
         osk();
+        renderer.draw = [this](const Frame & frame) { draw_frame(frame); };
+        renderer.refresh = [this]() { return run_refresher(); };
+        renderer.start();
     }
 };
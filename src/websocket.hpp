@@ -0,0 +1,233 @@
+/* inkvt - VT100 terminal for E-ink devices
+ * Copyright (C) 2020 Lennart Landsmeer <lennart@landsmeer.email>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+
+// Just enough RFC 6455 for a keyboard: the server side of the handshake,
+// and a streaming decoder for the frames the browser sends.
+class WebSocket {
+    static uint32_t rol(uint32_t x, int n) {
+        return (x << n) | (x >> (32 - n));
+    }
+
+    // SHA-1 is only used for the handshake, speed doesn't matter
+    static void sha1(const std::string & msg, uint8_t digest[20]) {
+        uint32_t h[5] = { 0x67452301u, 0xEFCDAB89u, 0x98BADCFEu, 0x10325476u, 0xC3D2E1F0u };
+        std::string m = msg;
+        uint64_t nbits = static_cast<uint64_t>(msg.size()) * 8u;
+        m.push_back(static_cast<char>(0x80));
+        while (m.size() % 64u != 56u) {
+            m.push_back(0);
+        }
+        for (int i = 7; i >= 0; i--) {
+            m.push_back(static_cast<char>(nbits >> (i * 8)));
+        }
+        for (size_t chunk = 0u; chunk < m.size(); chunk += 64u) {
+            uint32_t w[80];
+            for (int i = 0; i < 16; i++) {
+                const unsigned char * p = reinterpret_cast<const unsigned char *>(&m[chunk + static_cast<size_t>(i) * 4u]);
+                w[i] = static_cast<uint32_t>(p[0]) << 24 | static_cast<uint32_t>(p[1]) << 16 | static_cast<uint32_t>(p[2]) << 8 | p[3];
+            }
+            for (int i = 16; i < 80; i++) {
+                w[i] = rol(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
+            }
+            uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+            for (int i = 0; i < 80; i++) {
+                uint32_t f, k;
+                if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999u; }
+                else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1u; }
+                else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDCu; }
+                else { f = b ^ c ^ d; k = 0xCA62C1D6u; }
+                uint32_t t = rol(a, 5) + f + e + k + w[i];
+                e = d;
+                d = c;
+                c = rol(b, 30);
+                b = a;
+                a = t;
+            }
+            h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+        }
+        for (int i = 0; i < 20; i++) {
+            digest[i] = static_cast<uint8_t>(h[i / 4] >> (24 - (i % 4) * 8));
+        }
+    }
+
+    static std::string base64(const uint8_t * data, size_t len) {
+        static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::string out;
+        for (size_t i = 0u; i < len; i += 3u) {
+            uint32_t v = static_cast<uint32_t>(data[i]) << 16;
+            if (i + 1u < len) v |= static_cast<uint32_t>(data[i + 1u]) << 8;
+            if (i + 2u < len) v |= data[i + 2u];
+            out.push_back(alphabet[(v >> 18) & 63u]);
+            out.push_back(alphabet[(v >> 12) & 63u]);
+            out.push_back(i + 1u < len ? alphabet[(v >> 6) & 63u] : '=');
+            out.push_back(i + 2u < len ? alphabet[v & 63u] : '=');
+        }
+        return out;
+    }
+
+    enum {
+        WS_HEADER,
+        WS_LENGTH,
+        WS_LENGTH_EXT,
+        WS_MASK,
+        WS_PAYLOAD,
+    } state = WS_HEADER;
+    uint8_t opcode = 0u;
+    bool masked = false;
+    int nlength = 0; // extended length bytes still to come
+    int nmask = 0;   // mask bytes read so far
+    uint8_t mask[4] = { 0u, 0u, 0u, 0u };
+    uint64_t remaining = 0u;
+    uint64_t offset = 0u; // into the payload, for the mask
+    // payload of the current control frame
+    std::string control;
+
+    static bool is_control(uint8_t op) {
+        return op & 0x8u;
+    }
+
+    void start_payload(std::string & reply) {
+        offset = 0u;
+        control.clear();
+        state = WS_PAYLOAD;
+        if (remaining == 0u) {
+            end_frame(reply);
+        }
+    }
+
+    void end_frame(std::string & reply) {
+        state = WS_HEADER;
+        if (opcode == OP_PING) {
+            reply += frame(OP_PONG, control);
+        } else if (opcode == OP_CLOSE) {
+            // Echo the status code, then we're done
+            reply += frame(OP_CLOSE, control.substr(0u, 2u));
+            closed = true;
+        }
+    }
+
+public:
+    static constexpr uint8_t OP_CONTINUATION = 0x0u;
+    static constexpr uint8_t OP_TEXT = 0x1u;
+    static constexpr uint8_t OP_BINARY = 0x2u;
+    static constexpr uint8_t OP_CLOSE = 0x8u;
+    static constexpr uint8_t OP_PING = 0x9u;
+    static constexpr uint8_t OP_PONG = 0xAu;
+
+    // the client sent a close frame, or something we couldn't make sense of
+    bool closed = false;
+
+    // Sec-WebSocket-Accept for a Sec-WebSocket-Key
+    static std::string accept_key(const std::string & key) {
+        uint8_t digest[20];
+        sha1(key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11", digest);
+        return base64(digest, sizeof(digest));
+    }
+
+    // A single unmasked server frame, payload up to 125 bytes
+    static std::string frame(uint8_t op, const std::string & payload) {
+        std::string out;
+        out.push_back(static_cast<char>(0x80u | op));
+        out.push_back(static_cast<char>(std::min<size_t>(payload.size(), 125u)));
+        out.append(payload, 0u, 125u);
+        return out;
+    }
+
+    // Decodes whatever part of the stream arrived: data frame payloads are appended to output as they come in,
+    // answers to control frames to reply
+    void feed(const char * data, size_t len, std::deque<char> & output, std::string & reply) {
+        const uint8_t * p = reinterpret_cast<const uint8_t *>(data);
+        const uint8_t * end = p + len;
+        while (p < end && !closed) {
+            switch (state) {
+                case WS_HEADER:
+                    opcode = *p++ & 0x0Fu;
+                    state = WS_LENGTH;
+                    break;
+                case WS_LENGTH:
+                    masked = *p & 0x80u;
+                    remaining = *p++ & 0x7Fu;
+                    nmask = 0;
+                    if (remaining == 126u) {
+                        nlength = 2;
+                    } else if (remaining == 127u) {
+                        nlength = 8;
+                    } else {
+                        nlength = 0;
+                    }
+                    if (nlength > 0) {
+                        remaining = 0u;
+                        state = WS_LENGTH_EXT;
+                    } else if (masked) {
+                        state = WS_MASK;
+                    } else {
+                        start_payload(reply);
+                    }
+                    break;
+                case WS_LENGTH_EXT:
+                    remaining = remaining << 8 | *p++;
+                    if (--nlength == 0) {
+                        if (masked) {
+                            state = WS_MASK;
+                        } else {
+                            start_payload(reply);
+                        }
+                    }
+                    break;
+                case WS_MASK:
+                    mask[nmask++] = *p++;
+                    if (nmask == 4) {
+                        start_payload(reply);
+                    }
+                    break;
+                case WS_PAYLOAD: {
+                    size_t n = static_cast<size_t>(std::min<uint64_t>(remaining, static_cast<uint64_t>(end - p)));
+                    bool is_data = !is_control(opcode);
+                    if (!is_data && control.size() + n > 125u) {
+                        // Control frames can't be that large
+                        closed = true;
+                        break;
+                    }
+                    for (size_t i = 0u; i < n; i++) {
+                        char c = static_cast<char>(masked ? p[i] ^ mask[(offset + i) & 3u] : p[i]);
+                        if (is_data) {
+                            output.push_back(c);
+                        } else {
+                            control.push_back(c);
+                        }
+                    }
+                    p += n;
+                    offset += n;
+                    remaining -= n;
+                    if (remaining == 0u) {
+                        end_frame(reply);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+};